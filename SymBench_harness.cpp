@@ -0,0 +1,206 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Implementations for the timing harness and JSON reporting used by the benchmark suite
+ */
+
+// Normal includes
+#include "SymBench_harness.hpp"
+#include "Sym_data_types.hpp"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SymBench;
+
+namespace
+{
+    volatile std::uint64_t g_sink = 0;
+
+    std::string GetCompilerName()
+    {
+#if defined(__clang__)
+        return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+        return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + std::to_string(_MSC_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    // Only the label and compiler name can contain characters that need escaping
+    std::string EscapeJson(const std::string& text)
+    {
+        std::string escaped;
+        for (char c : text)
+        {
+            if (c == '\"' || c == '\\')
+            {
+                escaped += '\\';
+                escaped += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                escaped += ' ';
+            }
+            else
+            {
+                escaped += c;
+            }
+        }
+
+        return escaped;
+    }
+
+    double TimeIterations(const std::function<void()>& body, std::uint64_t iterations)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0; i < iterations; i++)
+        {
+            body();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double>(end - start).count();
+    }
+}
+
+const char* SymBench::GetInputKindName(InputKind kind)
+{
+    switch (kind)
+    {
+    case RANDOM:
+        return "random";
+    case IDENTITY:
+        return "identity";
+    case LONG_CYCLE:
+        return "long-cycle";
+    }
+
+    return "unknown";
+}
+
+void SymBench::MakeInput(InputKind kind, std::size_t degree, std::uint64_t seed, Sym::Permutation& permutation)
+{
+    permutation.resize(degree);
+    std::iota(permutation.begin(), permutation.end(), 1u);
+
+    if (kind == RANDOM)
+    {
+        std::mt19937_64 generator(seed);
+        std::shuffle(permutation.begin(), permutation.end(), generator);
+    }
+    else if (kind == LONG_CYCLE)
+    {
+        // The single cycle (1 2 ... n)
+        std::rotate(permutation.begin(), permutation.begin() + 1, permutation.end());
+    }
+}
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions& options) : m_options(options)
+{
+    if (m_options.m_samples < 1)
+        throw std::invalid_argument("A benchmark needs at least one sample.");
+}
+
+const BenchmarkOptions& BenchmarkRunner::Options() const
+{
+    return m_options;
+}
+
+bool BenchmarkRunner::ShouldRun(const std::string& name, std::size_t degree) const
+{
+    return degree <= m_options.m_maxDegree && name.find(m_options.m_filter) != std::string::npos;
+}
+
+void BenchmarkRunner::Run(const std::string& name, std::size_t degree, InputKind input, const std::function<void()>& body)
+{
+    if (!ShouldRun(name, degree))
+        return;
+
+    // Grow the iteration count until one sample takes long enough to time reliably. This doubles as the warm up.
+    std::uint64_t iterations = 1;
+    while (true)
+    {
+        double seconds = TimeIterations(body, iterations);
+        if (seconds >= m_options.m_minSampleSeconds)
+            break;
+
+        // Aim a little past the target so that the next attempt usually succeeds, but never more than 100x at once
+        double scale = seconds > 0 ? (m_options.m_minSampleSeconds * 1.2) / seconds : 100.0;
+        iterations = static_cast<std::uint64_t>(iterations * std::clamp(scale, 2.0, 100.0));
+    }
+
+    std::vector<double> samples;
+    for (int i = 0; i < m_options.m_samples; i++)
+    {
+        samples.push_back(TimeIterations(body, iterations) * 1e9 / static_cast<double>(iterations));
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    BenchmarkResult result;
+    result.m_name = name;
+    result.m_degree = degree;
+    result.m_input = input;
+    result.m_iterationsPerSample = iterations;
+    result.m_medianNanoseconds = samples[samples.size() / 2];
+    result.m_minNanoseconds = samples.front();
+    result.m_maxNanoseconds = samples.back();
+    m_results.push_back(result);
+}
+
+const std::vector<BenchmarkResult>& BenchmarkRunner::Results() const
+{
+    return m_results;
+}
+
+void BenchmarkRunner::WriteJson(std::ostream& out) const
+{
+    out << "{\n";
+    out << "  \"label\": \"" << EscapeJson(m_options.m_label) << "\",\n";
+    out << "  \"compiler\": \"" << EscapeJson(GetCompilerName()) << "\",\n";
+#if defined(NDEBUG)
+    out << "  \"assertions\": false,\n";
+#else
+    out << "  \"assertions\": true,\n";
+#endif
+    out << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    out << "  \"samples\": " << m_options.m_samples << ",\n";
+    out << "  \"min_sample_seconds\": " << m_options.m_minSampleSeconds << ",\n";
+    out << "  \"results\": [";
+
+    for (std::size_t i = 0; i < m_results.size(); i++)
+    {
+        const BenchmarkResult& result = m_results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\"name\": \"" << EscapeJson(result.m_name) << "\""
+            << ", \"degree\": " << result.m_degree
+            << ", \"input\": \"" << GetInputKindName(result.m_input) << "\""
+            << ", \"iterations\": " << result.m_iterationsPerSample
+            << ", \"median_ns\": " << result.m_medianNanoseconds
+            << ", \"min_ns\": " << result.m_minNanoseconds
+            << ", \"max_ns\": " << result.m_maxNanoseconds
+            << "}";
+    }
+
+    out << "\n  ]\n";
+    out << "}\n";
+}
+
+void SymBench::DoNotOptimize(std::uint64_t value)
+{
+    g_sink = g_sink + value;
+}
@@ -0,0 +1,89 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for the timing harness and JSON reporting used by the benchmark suite
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Sym_data_types.hpp"
+
+namespace SymBench
+{
+    // The shapes of permutation every routine is measured on
+    enum InputKind
+    {
+        RANDOM,
+        IDENTITY,
+        LONG_CYCLE
+    };
+
+    const char* GetInputKindName(InputKind kind);
+
+    // Fills permutation with a permutation of the given degree and shape. Random permutations are drawn from a
+    // generator seeded with 'seed', so every run (and every commit) measures exactly the same inputs.
+    void MakeInput(InputKind kind, std::size_t degree, std::uint64_t seed, Sym::Permutation& permutation);
+
+    struct BenchmarkOptions
+    {
+        // Each case is timed in m_samples samples of at least m_minSampleSeconds each
+        double m_minSampleSeconds = 0.02;
+        int m_samples = 5;
+
+        std::size_t m_maxDegree = 10000000;
+
+        // Only cases whose name contains this string are run
+        std::string m_filter = "";
+
+        // Free-form text copied into the report, e.g. the commit being measured
+        std::string m_label = "";
+    };
+
+    struct BenchmarkResult
+    {
+        std::string m_name;
+        std::size_t m_degree;
+        InputKind m_input;
+        std::uint64_t m_iterationsPerSample;
+        double m_medianNanoseconds;
+        double m_minNanoseconds;
+        double m_maxNanoseconds;
+    };
+
+    // Runs benchmark cases and collects one result per case.
+    //
+    // A case is a callable running the routine once. The runner first finds how many calls fill a sample, then
+    // times m_samples samples and reports the median, fastest and slowest time per call. Setup belongs outside the
+    // callable; anything the callable does besides the routine itself is part of the measurement.
+    class BenchmarkRunner
+    {
+    public:
+        explicit BenchmarkRunner(const BenchmarkOptions& options);
+
+        const BenchmarkOptions& Options() const;
+
+        // Whether a case with this name and degree would be run, so that expensive setup can be skipped
+        bool ShouldRun(const std::string& name, std::size_t degree) const;
+
+        void Run(const std::string& name, std::size_t degree, InputKind input, const std::function<void()>& body);
+
+        const std::vector<BenchmarkResult>& Results() const;
+
+        // Writes every result as a single JSON document
+        void WriteJson(std::ostream& out) const;
+
+    private:
+        BenchmarkOptions m_options;
+        std::vector<BenchmarkResult> m_results;
+    };
+
+    // Keeps the compiler from discarding a result that is otherwise unused
+    void DoNotOptimize(std::uint64_t value);
+}
@@ -0,0 +1,279 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: SymBench_main.cpp : Defines the entry point for the benchmark suite of the core Sym routines.
+ */
+
+// Normal includes
+#include "SymBench_harness.hpp"
+#include "Sym_cycle_notation_fast_parser.hpp"
+#include "Sym_cycle_notation_formatter.hpp"
+#include "Sym_data_types.hpp"
+#include "Sym_input_processing.hpp"
+#include "Sym_symmetric_group.hpp"
+
+// Standard C++ library includes
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace SymBench;
+
+namespace
+{
+    // Every routine is measured at each of these degrees, up to --max-degree
+    const std::size_t DEGREES[] = { 3, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+
+    const InputKind INPUT_KINDS[] = { RANDOM, IDENTITY, LONG_CYCLE };
+
+    // Number of factors in the words given to the vector overload of ComposePermutations
+    constexpr std::size_t WORD_LENGTH = 8;
+
+    // Number of permutations handed to ResizeAllToMax. All but the first are half the degree.
+    constexpr std::size_t RESIZE_COUNT = 8;
+
+    void PrintUsage()
+    {
+        std::cerr <<
+            "Usage: SymmetricGroupExplorerBench [options]\n"
+            "\n"
+            "Times the core Sym routines on random, identity and single long cycle permutations of degree 3 up to\n"
+            "10^7, and writes the results as JSON.\n"
+            "\n"
+            "Options:\n"
+            "  --output FILE       Write the JSON to FILE instead of standard output\n"
+            "  --filter TEXT       Only run benchmarks whose name contains TEXT\n"
+            "  --max-degree N      Skip degrees above N (default: 10000000)\n"
+            "  --samples N         Samples per benchmark; the median is reported (default: 5)\n"
+            "  --min-time SECONDS  Minimum length of one sample (default: 0.02)\n"
+            "  --label TEXT        Copied into the report, e.g. the commit being measured\n";
+    }
+
+    std::uint64_t GetSeed(std::size_t degree, std::size_t factor)
+    {
+        return degree * 1000003 + factor;
+    }
+
+    void BenchmarkComposition(BenchmarkRunner& runner, std::size_t degree, InputKind kind, const std::vector<Sym::Permutation>& factors)
+    {
+        runner.Run("ComposePermutations/pair", degree, kind, [&]()
+        {
+            Sym::Permutation product = Sym::ComposePermutations(factors[0], factors[1]);
+            DoNotOptimize(product[0]);
+        });
+
+        if (!runner.ShouldRun("ComposePermutations/vector", degree))
+            return;
+
+        Sym::PermutationVector word;
+        std::vector<Sym::Permutation> copies = factors;
+        for (Sym::Permutation& factor : copies)
+        {
+            word.push_back(&factor);
+        }
+
+        runner.Run("ComposePermutations/vector", degree, kind, [&]()
+        {
+            Sym::Permutation product = Sym::ComposePermutations(word);
+            DoNotOptimize(product[0]);
+        });
+    }
+
+    void BenchmarkQueries(BenchmarkRunner& runner, std::size_t degree, InputKind kind, const Sym::Permutation& permutation)
+    {
+        runner.Run("CalculateOrder", degree, kind, [&]()
+        {
+            Sym::BigInteger order = Sym::CalculateOrder(permutation);
+            DoNotOptimize(order.IsZero());
+        });
+
+        runner.Run("GetCycleNotationString", degree, kind, [&]()
+        {
+            std::string cycles = Sym::GetCycleNotationString(permutation);
+            DoNotOptimize(cycles.size());
+        });
+
+        Sym::CycleNotationFormatter formatter;
+        std::string text;
+        runner.Run("CycleNotationFormatter/append", degree, kind, [&]()
+        {
+            text.clear();
+            formatter.Append(permutation, text);
+            DoNotOptimize(text.size());
+        });
+
+        std::size_t streamed = 0;
+        Sym::CycleNotationFormatter::Sink sink = [&](std::string_view chunk) { streamed += chunk.size(); };
+        runner.Run("CycleNotationFormatter/sink", degree, kind, [&]()
+        {
+            formatter.Write(permutation, sink);
+            DoNotOptimize(streamed);
+        });
+    }
+
+    // The identity is written (1), so those cases measure only the fixed cost of a parse
+    void BenchmarkParsing(BenchmarkRunner& runner, std::size_t degree, InputKind kind, const Sym::Permutation& permutation)
+    {
+        if (!runner.ShouldRun("ProcessCycleNotationInput", degree) && !runner.ShouldRun("CycleNotationFastParser", degree))
+            return;
+
+        std::string cycles = Sym::GetCycleNotationString(permutation);
+
+        runner.Run("ProcessCycleNotationInput", degree, kind, [&]()
+        {
+            Sym::Permutation result = Sym::ProcessCycleNotationInput(cycles.c_str());
+            DoNotOptimize(result.size());
+        });
+
+        Sym::CycleNotationFastParser parser;
+        Sym::Permutation result;
+        runner.Run("CycleNotationFastParser", degree, kind, [&]()
+        {
+            parser.Parse(cycles, result);
+            DoNotOptimize(result.size());
+        });
+    }
+
+    void BenchmarkUserInput(BenchmarkRunner& runner, std::size_t degree, InputKind kind, const Sym::Permutation& permutation)
+    {
+        if (runner.ShouldRun("ProcessPermutationInput", degree))
+        {
+            // Simulates the user typing the last image into the first entry. ProcessPermutationInput finds the
+            // repeated value at the far end and swaps it, so consecutive calls swap the two entries back and forth.
+            Sym::Permutation current = permutation;
+            Sym::Permutation inputBuffer = permutation;
+            runner.Run("ProcessPermutationInput", degree, kind, [&]()
+            {
+                inputBuffer[0] = current[degree - 1];
+                Sym::ProcessPermutationInput(0, inputBuffer, current);
+                DoNotOptimize(current[0]);
+            });
+        }
+
+        if (runner.ShouldRun("ResizeAllToMax", degree))
+        {
+            std::vector<Sym::Permutation> permutations(RESIZE_COUNT);
+            permutations[0] = permutation;
+            const std::size_t smallDegree = degree / 2 > 0 ? degree / 2 : 1;
+
+            Sym::PermutationVector permVector;
+            for (Sym::Permutation& small : permutations)
+            {
+                if (&small != &permutations[0])
+                    MakeInput(IDENTITY, smallDegree, 0, small);
+                permVector.push_back(&small);
+            }
+
+            // Shrinking back afterwards keeps the capacity, so it costs next to nothing and nothing is reallocated
+            runner.Run("ResizeAllToMax", degree, kind, [&]()
+            {
+                Sym::ResizeAllToMax(permVector);
+                for (std::size_t i = 1; i < RESIZE_COUNT; i++)
+                {
+                    permutations[i].resize(smallDegree);
+                }
+                DoNotOptimize(permutations[1].capacity());
+            });
+        }
+    }
+
+    int Run(int argc, char** argv)
+    {
+        BenchmarkOptions options;
+        std::string outputPath;
+
+        try
+        {
+            for (int i = 1; i < argc; i++)
+            {
+                std::string option = argv[i];
+                if (option == "--help")
+                {
+                    PrintUsage();
+                    return 0;
+                }
+
+                if (i + 1 >= argc)
+                    throw std::invalid_argument("Option \'" + option + "\' is missing its value.");
+
+                std::string value = argv[++i];
+                if (option == "--output")
+                    outputPath = value;
+                else if (option == "--filter")
+                    options.m_filter = value;
+                else if (option == "--max-degree")
+                    options.m_maxDegree = std::stoull(value);
+                else if (option == "--samples")
+                    options.m_samples = std::stoi(value);
+                else if (option == "--min-time")
+                    options.m_minSampleSeconds = std::stod(value);
+                else if (option == "--label")
+                    options.m_label = value;
+                else
+                    throw std::invalid_argument("Unknown option \'" + option + "\'.");
+            }
+        }
+        catch (const std::invalid_argument& e)
+        {
+            std::cerr << e.what() << "\n\n";
+            PrintUsage();
+            return 2;
+        }
+
+        BenchmarkRunner runner(options);
+
+        for (std::size_t degree : DEGREES)
+        {
+            if (degree > options.m_maxDegree)
+                break;
+
+            for (InputKind kind : INPUT_KINDS)
+            {
+                std::cerr << "Degree " << degree << ", " << GetInputKindName(kind) << " input\n";
+
+                std::vector<Sym::Permutation> factors(WORD_LENGTH);
+                for (std::size_t j = 0; j < WORD_LENGTH; j++)
+                {
+                    MakeInput(kind, degree, GetSeed(degree, j), factors[j]);
+                }
+
+                BenchmarkComposition(runner, degree, kind, factors);
+                BenchmarkQueries(runner, degree, kind, factors[0]);
+                BenchmarkParsing(runner, degree, kind, factors[0]);
+                BenchmarkUserInput(runner, degree, kind, factors[0]);
+            }
+        }
+
+        if (outputPath.empty())
+        {
+            runner.WriteJson(std::cout);
+            return 0;
+        }
+
+        std::ofstream output(outputPath);
+        if (!output)
+            throw std::runtime_error("Could not open \'" + outputPath + "\' for writing.");
+
+        runner.WriteJson(output);
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        return Run(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 2;
+    }
+}
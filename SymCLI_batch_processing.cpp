@@ -0,0 +1,328 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Definitions of routines for processing streams of permutations from the command line
+ */
+
+// Normal includes
+#include "SymCLI_batch_processing.hpp"
+#include "Sym_composition_engine.hpp"
+#include "Sym_cycle_notation_fast_parser.hpp"
+#include "Sym_cycle_notation_formatter.hpp"
+#include "Sym_data_types.hpp"
+#include "Sym_input_processing.hpp"
+#include "Sym_schreier_sims.hpp"
+#include "Sym_symmetric_group.hpp"
+#include "Sym_thread_pool.hpp"
+
+// C++ Standard Library includes
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // Everything one worker needs to process lines, kept between pieces so it stops allocating after warm-up
+    struct WorkerState
+    {
+        Sym::CycleNotationFastParser m_parser;
+        Sym::CompositionEngine m_engine;
+        Sym::CycleNotationFormatter m_formatter;
+        Sym::Permutation m_input;
+        Sym::Permutation m_fixed;
+        Sym::Permutation m_output;
+        std::size_t m_errors = 0;
+    };
+
+    void ExtendWithFixedPoints(Sym::Permutation& permutation, std::size_t size)
+    {
+        for (std::size_t i = permutation.size(); i < size; i++)
+        {
+            permutation.push_back(static_cast<std::uint32_t>(i + 1));
+        }
+    }
+
+    void AppendNumber(std::string& out, std::uint32_t value)
+    {
+        char digits[16];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        out.append(digits, result.ptr);
+    }
+
+    void AppendPermutation(std::string& out, const Sym::Permutation& permutation, SymCLI::Notation notation, WorkerState& state)
+    {
+        if (notation == SymCLI::CYCLE)
+        {
+            state.m_formatter.Append(permutation, out);
+            return;
+        }
+
+        for (std::size_t i = 0; i < permutation.size(); i++)
+        {
+            if (i != 0)
+                out += ' ';
+            AppendNumber(out, permutation[i]);
+        }
+    }
+
+    void ParseLine(std::string_view line, SymCLI::Notation notation, WorkerState& state)
+    {
+        if (notation == SymCLI::CYCLE)
+            state.m_parser.Parse(line, state.m_input);
+        else
+            Sym::ProcessTableNotationInput(line, state.m_input);
+    }
+
+    void ProcessLine(std::string_view line, const SymCLI::BatchOptions& options, WorkerState& state, std::string& out)
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+
+        try
+        {
+            ParseLine(line, options.m_inputNotation, state);
+
+            switch (options.m_operation)
+            {
+            case SymCLI::CANONICAL:
+                AppendPermutation(out, state.m_input, options.m_outputNotation, state);
+                break;
+
+            case SymCLI::COMPOSE:
+            {
+                // Like the calculator, a permutation on fewer symbols is treated as fixing the extra ones
+                const Sym::Permutation* fixed = &options.m_fixedElement;
+                if (state.m_input.size() != fixed->size())
+                {
+                    state.m_fixed = *fixed;
+                    ExtendWithFixedPoints(state.m_fixed, state.m_input.size());
+                    ExtendWithFixedPoints(state.m_input, state.m_fixed.size());
+                    fixed = &state.m_fixed;
+                }
+
+                if (options.m_composeSide == SymCLI::LEFT)
+                    state.m_engine.Compose(*fixed, state.m_input, state.m_output);
+                else
+                    state.m_engine.Compose(state.m_input, *fixed, state.m_output);
+
+                AppendPermutation(out, state.m_output, options.m_outputNotation, state);
+                break;
+            }
+
+            case SymCLI::ORDER:
+                out += Sym::CalculateOrder(state.m_input).ToString();
+                break;
+
+            case SymCLI::INVERSE:
+                Sym::InvertPermutation(state.m_input, state.m_output);
+                AppendPermutation(out, state.m_output, options.m_outputNotation, state);
+                break;
+
+            case SymCLI::CYCLE_TYPE:
+            {
+                std::vector<std::uint32_t> cycleType = Sym::GetCycleType(state.m_input);
+                for (std::size_t i = 0; i < cycleType.size(); i++)
+                {
+                    if (i != 0)
+                        out += ' ';
+                    AppendNumber(out, cycleType[i]);
+                }
+                break;
+            }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            out += "error: ";
+            out += e.what();
+            state.m_errors++;
+        }
+
+        out += '\n';
+    }
+
+    void ProcessPiece(std::string_view piece, const SymCLI::BatchOptions& options, WorkerState& state, std::string& out)
+    {
+        out.clear();
+
+        std::size_t lineStart = 0;
+        while (lineStart < piece.size())
+        {
+            std::size_t lineEnd = piece.find('\n', lineStart);
+            if (lineEnd == std::string_view::npos)
+                lineEnd = piece.size();
+
+            ProcessLine(piece.substr(lineStart, lineEnd - lineStart), options, state, out);
+            lineStart = lineEnd + 1;
+        }
+    }
+}
+
+std::size_t SymCLI::ProcessStream(std::FILE* input, std::FILE* output, const BatchOptions& options)
+{
+    if (options.m_operation == GROUP)
+        return ProcessGroup(input, output, options);
+
+    Sym::ThreadPool pool(options.m_threadCount);
+    std::vector<WorkerState> workers(pool.Size());
+
+    // A few pieces per worker, so that a slow piece doesn't leave the others idle
+    const std::size_t pieceSize = options.m_pieceSize > 0 ? options.m_pieceSize : 1;
+    const std::size_t piecesPerBlock = pool.Size() * 4;
+    std::vector<char> block(pieceSize * piecesPerBlock);
+    std::vector<std::string_view> pieces;
+    std::vector<std::string> pieceOutputs(piecesPerBlock);
+
+    std::size_t carried = 0;
+    bool endOfInput = false;
+    while (!endOfInput)
+    {
+        // Top up the block after whatever partial line was left over from the last one
+        std::size_t filled = carried + std::fread(block.data() + carried, 1, block.size() - carried, input);
+        endOfInput = filled < block.size();
+
+        // Only whole lines are processed, unless this is the end of the input
+        std::size_t usable = filled;
+        if (!endOfInput)
+        {
+            std::size_t lastNewline = std::string_view(block.data(), filled).rfind('\n');
+
+            // A single line longer than the whole block: grow the block and keep reading
+            if (lastNewline == std::string_view::npos)
+            {
+                carried = filled;
+                block.resize(block.size() * 2);
+                continue;
+            }
+
+            usable = lastNewline + 1;
+        }
+
+        // Cut the usable bytes into pieces of about pieceSize, each ending at a line boundary
+        pieces.clear();
+        std::string_view remaining(block.data(), usable);
+        while (!remaining.empty())
+        {
+            std::size_t cut = remaining.size();
+            if (cut > pieceSize)
+            {
+                std::size_t newline = remaining.find('\n', pieceSize - 1);
+                cut = (newline == std::string_view::npos) ? remaining.size() : newline + 1;
+            }
+
+            pieces.push_back(remaining.substr(0, cut));
+            remaining.remove_prefix(cut);
+        }
+
+        if (pieceOutputs.size() < pieces.size())
+            pieceOutputs.resize(pieces.size());
+
+        pool.ParallelFor(pieces.size(), 1, [&](std::size_t begin, std::size_t end, unsigned workerIndex)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                ProcessPiece(pieces[i], options, workers[workerIndex], pieceOutputs[i]);
+            }
+        });
+
+        for (std::size_t i = 0; i < pieces.size(); i++)
+        {
+            if (std::fwrite(pieceOutputs[i].data(), 1, pieceOutputs[i].size(), output) != pieceOutputs[i].size())
+                throw std::runtime_error("Failed to write the output.");
+        }
+
+        // Move the partial last line to the front of the block for the next round
+        carried = filled - usable;
+        std::memmove(block.data(), block.data() + usable, carried);
+    }
+
+    if (std::ferror(input))
+        throw std::runtime_error("Failed to read the input.");
+
+    std::size_t errors = 0;
+    for (const WorkerState& worker : workers)
+    {
+        errors += worker.m_errors;
+    }
+
+    return errors;
+}
+
+std::size_t SymCLI::ProcessGroup(std::FILE* input, std::FILE* output, const BatchOptions& options)
+{
+    // The generators of a group are few, so there is no need for the block-wise parallel reading of ProcessStream
+    std::string text;
+    std::vector<char> buffer(options.m_pieceSize > 0 ? options.m_pieceSize : 1);
+    std::size_t bytesRead;
+    while ((bytesRead = std::fread(buffer.data(), 1, buffer.size(), input)) > 0)
+    {
+        text.append(buffer.data(), bytesRead);
+    }
+
+    if (std::ferror(input))
+        throw std::runtime_error("Failed to read the input.");
+
+    WorkerState state;
+    std::vector<Sym::Permutation> generators;
+    std::string out;
+    std::size_t errors = 0;
+
+    std::string_view remaining(text);
+    for (std::size_t lineNumber = 1; !remaining.empty(); lineNumber++)
+    {
+        std::size_t lineEnd = remaining.find('\n');
+        std::string_view line = remaining.substr(0, lineEnd);
+        remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        if (line.empty())
+            continue;
+
+        try
+        {
+            ParseLine(line, options.m_inputNotation, state);
+            generators.push_back(state.m_input);
+        }
+        catch (const std::exception& e)
+        {
+            out += "error: line " + std::to_string(lineNumber) + ": " + e.what() + "\n";
+            errors++;
+        }
+    }
+
+    if (errors == 0)
+    {
+        Sym::PermutationVector generatorPointers;
+        for (Sym::Permutation& generator : generators)
+        {
+            generatorPointers.push_back(&generator);
+        }
+
+        Sym::StabilizerChain chain = Sym::StabilizerChain::FromGenerators(generatorPointers);
+
+        out += "order: " + chain.Order().ToString() + "\n";
+        out += "base:";
+        for (std::uint32_t point : chain.Base())
+        {
+            out += ' ';
+            AppendNumber(out, point);
+        }
+        out += "\nstrong-generators: " + std::to_string(chain.StrongGenerators().size()) + "\n";
+
+        if (options.m_haveFixedElement)
+            out += std::string("contains: ") + (chain.Contains(options.m_fixedElement) ? "yes" : "no") + "\n";
+    }
+
+    if (std::fwrite(out.data(), 1, out.size(), output) != out.size())
+        throw std::runtime_error("Failed to write the output.");
+
+    return errors;
+}
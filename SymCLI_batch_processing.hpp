@@ -0,0 +1,56 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations of routines for processing streams of permutations from the command line
+ */
+
+#pragma once
+
+// Normal includes
+#include "Sym_data_types.hpp"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <cstdio>
+
+namespace SymCLI
+{
+    // GROUP treats the whole input as the generators of one group rather than processing each line on its own
+    enum Operation { CANONICAL, COMPOSE, ORDER, INVERSE, CYCLE_TYPE, GROUP };
+
+    // Same notations as SymUI::InputMode
+    enum Notation { TABLE, CYCLE };
+
+    // Which side of each input permutation the fixed element goes on when composing
+    enum ComposeSide { LEFT, RIGHT };
+
+    struct BatchOptions
+    {
+        Operation m_operation = CANONICAL;
+        Notation m_inputNotation = CYCLE;
+        Notation m_outputNotation = CYCLE;
+        ComposeSide m_composeSide = RIGHT;
+
+        // The fixed element for COMPOSE, or the element to test for membership with GROUP
+        Sym::Permutation m_fixedElement;
+        bool m_haveFixedElement = false;
+
+        unsigned m_threadCount = 1;
+
+        // Input is read and handed to the workers in pieces of roughly this many bytes, each cut at a line boundary
+        std::size_t m_pieceSize = 1 << 20;
+    };
+
+    // Reads one permutation per line from input, applies the operation, and writes one result per line to output, in
+    // the same order. A line which can't be processed produces a line starting with "error: " instead, so that output
+    // lines always match up with input lines. Returns the number of such lines.
+    //
+    // Several pieces of input are read at a time and processed in parallel, and all I/O goes through large buffers.
+    std::size_t ProcessStream(std::FILE* input, std::FILE* output, const BatchOptions& options);
+
+    // Reads one generator per line and writes a report on the group they generate: its order, a base, the number of
+    // strong generators found by Schreier-Sims and, if a fixed element was given, whether it belongs to the group.
+    // Lines which can't be parsed are reported as "error: line N: ..." and no group is computed. Returns the number
+    // of such lines. ProcessStream hands GROUP over to this.
+    std::size_t ProcessGroup(std::FILE* input, std::FILE* output, const BatchOptions& options);
+}
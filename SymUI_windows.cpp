@@ -13,6 +13,7 @@
 #include <cpptrace/from_current_macros.hpp>
 
 // Normal includes
+#include "Sym_composition_engine.hpp"
 #include "Sym_data_types.hpp"
 #include "Sym_errors.hpp"
 #include "Sym_input_processing.hpp"
@@ -117,6 +118,7 @@ void SymUI::CalculatorWindow(bool& showWindow)
     static char rawCycleInput1[30] = "(1 2 3)";
     static char rawCycleInput2[30] = "(1 2 3)";
     static std::string compositionString;
+    static Sym::CompositionEngine compositionEngine;
 
     if (inputMode == TABLE)
     {
@@ -279,7 +281,7 @@ void SymUI::CalculatorWindow(bool& showWindow)
         {
             CPPTRACE_TRY
             {
-                composition = Sym::ComposePermutations(permutation1, permutation2);
+                compositionEngine.Compose(permutation1, permutation2, composition);
             }
             CPPTRACE_CATCH(const std::exception& e)
             {
@@ -348,7 +350,7 @@ void SymUI::CalculatorWindow(bool& showWindow)
                 Sym::PermutationVector permVec = { &permutation1, &permutation2 };
                 Sym::ResizeAllToMax(permVec);
 
-                composition = Sym::ComposePermutations(permutation1, permutation2);
+                compositionEngine.Compose(permutation1, permutation2, composition);
                 compositionString = Sym::GetCycleNotationString(composition);
             }
             CPPTRACE_CATCH(const std::exception& e)
@@ -382,7 +384,7 @@ void SymUI::OrderWindow(bool& showWindow)
     static Sym::Permutation inputBuffer = Sym::InitializePermutation(n);
     static Sym::Permutation permutation = Sym::InitializePermutation(n);
     static Sym::PermutationVector permVector = { &inputBuffer, &permutation };
-    static int order = 1;
+    static std::string order = "1";
 
     ImGui::Begin("Order", &showWindow);
 
@@ -428,7 +430,7 @@ void SymUI::OrderWindow(bool& showWindow)
     {
         CPPTRACE_TRY
         {
-            order = Sym::CalculateOrder(permutation);
+            order = Sym::CalculateOrder(permutation).ToString();
         }
         CPPTRACE_CATCH(const std::exception & e)
         {
@@ -438,7 +440,7 @@ void SymUI::OrderWindow(bool& showWindow)
         }
     }
 
-    ImGui::Text("Order: %d", order);
+    ImGui::Text("Order: %s", order.c_str());
 
     ImGui::End();
 }
@@ -0,0 +1,346 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Implementations for the arbitrary-precision integer type
+ */
+
+#include "Sym_big_integer.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Sym;
+
+namespace
+{
+    // Largest power of ten which fits in a limb. Conversions to and from decimal work nine digits at a time.
+    constexpr std::uint32_t DECIMAL_CHUNK = 1000000000;
+    constexpr int DECIMAL_CHUNK_DIGITS = 9;
+}
+
+BigInteger::BigInteger() : m_negative(false)
+{
+}
+
+BigInteger::BigInteger(std::int64_t value) : m_negative(value < 0)
+{
+    // Negate in unsigned arithmetic so that INT64_MIN does not overflow
+    std::uint64_t magnitude = m_negative ? (~static_cast<std::uint64_t>(value) + 1) : static_cast<std::uint64_t>(value);
+    while (magnitude != 0)
+    {
+        m_limbs.push_back(static_cast<std::uint32_t>(magnitude));
+        magnitude >>= 32;
+    }
+}
+
+BigInteger BigInteger::FromUInt64(std::uint64_t value)
+{
+    BigInteger result;
+    while (value != 0)
+    {
+        result.m_limbs.push_back(static_cast<std::uint32_t>(value));
+        value >>= 32;
+    }
+
+    return result;
+}
+
+BigInteger BigInteger::FromString(const std::string& text)
+{
+    std::size_t pos = 0;
+    bool negative = false;
+    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-'))
+    {
+        negative = text[pos] == '-';
+        pos++;
+    }
+
+    if (pos == text.size())
+        throw std::invalid_argument("Expected a decimal integer, but got \'" + text + "\'.");
+
+    BigInteger result;
+    while (pos < text.size())
+    {
+        std::uint32_t chunk = 0;
+        std::uint32_t scale = 1;
+        for (int i = 0; i < DECIMAL_CHUNK_DIGITS && pos < text.size(); i++, pos++)
+        {
+            char c = text[pos];
+            if (c < '0' || c > '9')
+                throw std::invalid_argument("Expected a decimal integer, but got \'" + text + "\'.");
+
+            chunk = chunk * 10 + static_cast<std::uint32_t>(c - '0');
+            scale *= 10;
+        }
+
+        result.MultiplyBy(scale);
+        result.AddSmall(chunk);
+    }
+
+    result.m_negative = negative && !result.IsZero();
+    return result;
+}
+
+bool BigInteger::IsZero() const
+{
+    return m_limbs.empty();
+}
+
+bool BigInteger::IsNegative() const
+{
+    return m_negative;
+}
+
+bool BigInteger::FitsInUInt64() const
+{
+    return m_limbs.size() <= 2;
+}
+
+std::uint64_t BigInteger::ToUInt64() const
+{
+    std::uint64_t value = 0;
+    if (m_limbs.size() > 0)
+        value = m_limbs[0];
+    if (m_limbs.size() > 1)
+        value |= static_cast<std::uint64_t>(m_limbs[1]) << 32;
+
+    return value;
+}
+
+std::string BigInteger::ToString() const
+{
+    if (IsZero())
+        return "0";
+
+    // Peel off nine decimal digits at a time, least significant chunk first
+    BigInteger temp = *this;
+    std::vector<std::uint32_t> chunks;
+    while (!temp.IsZero())
+    {
+        chunks.push_back(temp.DivideBy(DECIMAL_CHUNK));
+    }
+
+    std::string result = m_negative ? "-" : "";
+    result += std::to_string(chunks.back());
+    for (auto iter = chunks.rbegin() + 1; iter != chunks.rend(); iter++)
+    {
+        std::string chunk = std::to_string(*iter);
+        result.append(DECIMAL_CHUNK_DIGITS - chunk.size(), '0');
+        result += chunk;
+    }
+
+    return result;
+}
+
+BigInteger& BigInteger::MultiplyBy(std::uint32_t factor)
+{
+    if (factor == 0)
+    {
+        m_limbs.clear();
+        m_negative = false;
+        return *this;
+    }
+
+    std::uint64_t carry = 0;
+    for (std::uint32_t& limb : m_limbs)
+    {
+        std::uint64_t product = static_cast<std::uint64_t>(limb) * factor + carry;
+        limb = static_cast<std::uint32_t>(product);
+        carry = product >> 32;
+    }
+
+    if (carry != 0)
+        m_limbs.push_back(static_cast<std::uint32_t>(carry));
+
+    return *this;
+}
+
+BigInteger& BigInteger::AddSmall(std::uint32_t addend)
+{
+    if (m_negative)
+        return *this += BigInteger(static_cast<std::int64_t>(addend));
+
+    std::uint64_t carry = addend;
+    for (std::size_t i = 0; i < m_limbs.size() && carry != 0; i++)
+    {
+        std::uint64_t sum = static_cast<std::uint64_t>(m_limbs[i]) + carry;
+        m_limbs[i] = static_cast<std::uint32_t>(sum);
+        carry = sum >> 32;
+    }
+
+    if (carry != 0)
+        m_limbs.push_back(static_cast<std::uint32_t>(carry));
+
+    return *this;
+}
+
+std::uint32_t BigInteger::DivideBy(std::uint32_t divisor)
+{
+    if (divisor == 0)
+        throw std::invalid_argument("Attempted to divide a BigInteger by zero.");
+
+    std::uint64_t remainder = 0;
+    for (auto iter = m_limbs.rbegin(); iter != m_limbs.rend(); iter++)
+    {
+        std::uint64_t current = (remainder << 32) | *iter;
+        *iter = static_cast<std::uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+
+    Trim();
+    return static_cast<std::uint32_t>(remainder);
+}
+
+std::uint32_t BigInteger::Mod(std::uint32_t modulus) const
+{
+    if (modulus == 0)
+        throw std::invalid_argument("Attempted to reduce a BigInteger modulo zero.");
+
+    std::uint64_t remainder = 0;
+    for (auto iter = m_limbs.rbegin(); iter != m_limbs.rend(); iter++)
+    {
+        remainder = ((remainder << 32) | *iter) % modulus;
+    }
+
+    if (m_negative && remainder != 0)
+        remainder = modulus - remainder;
+
+    return static_cast<std::uint32_t>(remainder);
+}
+
+BigInteger BigInteger::operator-() const
+{
+    BigInteger result = *this;
+    result.m_negative = !m_negative && !IsZero();
+    return result;
+}
+
+BigInteger& BigInteger::operator+=(const BigInteger& other)
+{
+    if (m_negative == other.m_negative)
+    {
+        AddMagnitude(m_limbs, other.m_limbs);
+    }
+    else if (CompareMagnitude(m_limbs, other.m_limbs) >= 0)
+    {
+        SubtractMagnitude(m_limbs, other.m_limbs);
+    }
+    else
+    {
+        std::vector<std::uint32_t> magnitude = other.m_limbs;
+        SubtractMagnitude(magnitude, m_limbs);
+        m_limbs.swap(magnitude);
+        m_negative = other.m_negative;
+    }
+
+    Trim();
+    return *this;
+}
+
+BigInteger& BigInteger::operator-=(const BigInteger& other)
+{
+    return *this += -other;
+}
+
+BigInteger& BigInteger::operator*=(const BigInteger& other)
+{
+    if (IsZero() || other.IsZero())
+    {
+        m_limbs.clear();
+        m_negative = false;
+        return *this;
+    }
+
+    std::vector<std::uint32_t> product(m_limbs.size() + other.m_limbs.size(), 0);
+    for (std::size_t i = 0; i < m_limbs.size(); i++)
+    {
+        std::uint64_t carry = 0;
+        for (std::size_t j = 0; j < other.m_limbs.size(); j++)
+        {
+            std::uint64_t current = static_cast<std::uint64_t>(m_limbs[i]) * other.m_limbs[j] + product[i + j] + carry;
+            product[i + j] = static_cast<std::uint32_t>(current);
+            carry = current >> 32;
+        }
+        product[i + other.m_limbs.size()] = static_cast<std::uint32_t>(carry);
+    }
+
+    m_limbs.swap(product);
+    m_negative = m_negative != other.m_negative;
+    Trim();
+    return *this;
+}
+
+bool Sym::operator==(const BigInteger& lhs, const BigInteger& rhs)
+{
+    return lhs.m_negative == rhs.m_negative && lhs.m_limbs == rhs.m_limbs;
+}
+
+bool Sym::operator<(const BigInteger& lhs, const BigInteger& rhs)
+{
+    if (lhs.m_negative != rhs.m_negative)
+        return lhs.m_negative;
+
+    int comparison = BigInteger::CompareMagnitude(lhs.m_limbs, rhs.m_limbs);
+    return lhs.m_negative ? comparison > 0 : comparison < 0;
+}
+
+int BigInteger::CompareMagnitude(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b)
+{
+    if (a.size() != b.size())
+        return a.size() < b.size() ? -1 : 1;
+
+    for (std::size_t i = a.size(); i-- > 0;)
+    {
+        if (a[i] != b[i])
+            return a[i] < b[i] ? -1 : 1;
+    }
+
+    return 0;
+}
+
+void BigInteger::AddMagnitude(std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b)
+{
+    if (a.size() < b.size())
+        a.resize(b.size(), 0);
+
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        std::uint64_t sum = static_cast<std::uint64_t>(a[i]) + (i < b.size() ? b[i] : 0) + carry;
+        a[i] = static_cast<std::uint32_t>(sum);
+        carry = sum >> 32;
+
+        if (carry == 0 && i >= b.size())
+            break;
+    }
+
+    if (carry != 0)
+        a.push_back(static_cast<std::uint32_t>(carry));
+}
+
+void BigInteger::SubtractMagnitude(std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b)
+{
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        std::int64_t difference = static_cast<std::int64_t>(a[i]) - (i < b.size() ? b[i] : 0) - borrow;
+        borrow = difference < 0 ? 1 : 0;
+        a[i] = static_cast<std::uint32_t>(difference + (borrow << 32));
+
+        if (borrow == 0 && i >= b.size())
+            break;
+    }
+}
+
+void BigInteger::Trim()
+{
+    while (!m_limbs.empty() && m_limbs.back() == 0)
+    {
+        m_limbs.pop_back();
+    }
+
+    if (m_limbs.empty())
+        m_negative = false;
+}
@@ -0,0 +1,80 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for an arbitrary-precision integer type, used for quantities (such as the order of a
+             permutation) which quickly outgrow the fixed-width integer types.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Sym
+{
+    // Signed arbitrary-precision integer, stored as a sign flag and a magnitude made of 32-bit limbs with the
+    // least significant limb first. Zero is always stored with no limbs and a positive sign.
+    //
+    // Most of the numbers the core algorithms produce are built up as products of small factors (cycle lengths,
+    // orbit sizes, etc.), so multiplying and dividing by a single 32-bit value are the cheap operations here.
+    class BigInteger
+    {
+    public:
+        BigInteger();
+        BigInteger(std::int64_t value);
+
+        static BigInteger FromUInt64(std::uint64_t value);
+
+        // Accepts an optional leading '+' or '-' followed by one or more decimal digits.
+        static BigInteger FromString(const std::string& text);
+
+        bool IsZero() const;
+        bool IsNegative() const;
+        bool FitsInUInt64() const;
+
+        // Returns the magnitude. Only meaningful when FitsInUInt64() is true.
+        std::uint64_t ToUInt64() const;
+
+        std::string ToString() const;
+
+        BigInteger& MultiplyBy(std::uint32_t factor);
+        BigInteger& AddSmall(std::uint32_t addend);
+
+        // Divides the magnitude in place (truncating toward zero) and returns the remainder of the magnitude.
+        std::uint32_t DivideBy(std::uint32_t divisor);
+
+        // Returns the value reduced into the range [0, modulus), so negative values wrap around as in modular arithmetic.
+        std::uint32_t Mod(std::uint32_t modulus) const;
+
+        BigInteger operator-() const;
+        BigInteger& operator+=(const BigInteger& other);
+        BigInteger& operator-=(const BigInteger& other);
+        BigInteger& operator*=(const BigInteger& other);
+
+        friend BigInteger operator+(BigInteger lhs, const BigInteger& rhs) { return lhs += rhs; }
+        friend BigInteger operator-(BigInteger lhs, const BigInteger& rhs) { return lhs -= rhs; }
+        friend BigInteger operator*(BigInteger lhs, const BigInteger& rhs) { return lhs *= rhs; }
+
+        friend bool operator==(const BigInteger& lhs, const BigInteger& rhs);
+        friend bool operator!=(const BigInteger& lhs, const BigInteger& rhs) { return !(lhs == rhs); }
+        friend bool operator<(const BigInteger& lhs, const BigInteger& rhs);
+        friend bool operator>(const BigInteger& lhs, const BigInteger& rhs) { return rhs < lhs; }
+        friend bool operator<=(const BigInteger& lhs, const BigInteger& rhs) { return !(rhs < lhs); }
+        friend bool operator>=(const BigInteger& lhs, const BigInteger& rhs) { return !(lhs < rhs); }
+
+    private:
+        static int CompareMagnitude(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b);
+        static void AddMagnitude(std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b);
+        // Requires |a| >= |b|
+        static void SubtractMagnitude(std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b);
+
+        void Trim();
+
+        std::vector<std::uint32_t> m_limbs;
+        bool m_negative;
+    };
+
+    bool operator==(const BigInteger& lhs, const BigInteger& rhs);
+    bool operator<(const BigInteger& lhs, const BigInteger& rhs);
+}
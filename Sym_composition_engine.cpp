@@ -0,0 +1,149 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Implementations for the allocation-free permutation composition engine
+ */
+
+#include "Sym_composition_engine.hpp"
+#include "Sym_data_types.hpp"
+#include "Sym_permutation_batch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+using namespace Sym;
+
+namespace
+{
+    // Adapters giving both kinds of word the same interface for CompositionEngine::Fold
+    struct VectorWord
+    {
+        const PermutationVector& m_permutations;
+
+        std::size_t Count() const { return m_permutations.size(); }
+        std::size_t Degree(std::size_t j) const { return m_permutations[j]->size(); }
+        const std::uint32_t* Factor(std::size_t j) const { return m_permutations[j]->data(); }
+    };
+
+    struct BatchWord
+    {
+        const PermutationBatchView& m_batch;
+
+        std::size_t Count() const { return m_batch.Count(); }
+        std::size_t Degree(std::size_t j) const { return m_batch.Degree(); }
+        const std::uint32_t* Factor(std::size_t j) const { return m_batch[j].data(); }
+    };
+}
+
+const Permutation& CompositionEngine::Compose(const PermutationVector& word)
+{
+    Fold(VectorWord{ word }, m_front, m_back);
+    return m_front;
+}
+
+void CompositionEngine::Compose(const PermutationVector& word, Permutation& output)
+{
+    bool outputIsFactor = false;
+    for (const Permutation* perm : word)
+    {
+        if (perm == &output)
+        {
+            outputIsFactor = true;
+            break;
+        }
+    }
+
+    if (outputIsFactor)
+    {
+        // Writing into a factor would clobber it before it is read, so fold internally and copy out at the end.
+        // Assigning into existing capacity does not allocate.
+        Fold(VectorWord{ word }, m_front, m_back);
+        output = m_front;
+    }
+    else
+    {
+        Fold(VectorWord{ word }, output, m_front);
+    }
+}
+
+const Permutation& CompositionEngine::Compose(const PermutationBatchView& word)
+{
+    Fold(BatchWord{ word }, m_front, m_back);
+    return m_front;
+}
+
+void CompositionEngine::Compose(const PermutationBatchView& word, Permutation& output)
+{
+    // A batch never shares memory with a Permutation, so the output can take part in the fold directly
+    Fold(BatchWord{ word }, output, m_front);
+}
+
+void CompositionEngine::Compose(const Permutation& permutation1, const Permutation& permutation2, Permutation& output)
+{
+    if (permutation1.size() != permutation2.size())
+        throw std::invalid_argument("Cannot compose permutations of different sizes.");
+
+    const std::size_t n = permutation2.size();
+    Permutation& target = (&output == &permutation1 || &output == &permutation2) ? m_front : output;
+    target.resize(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        target[i] = permutation1[permutation2[i] - 1];
+    }
+
+    if (&target != &output)
+        output = target;
+}
+
+template <typename Word>
+void CompositionEngine::Fold(const Word& word, Permutation& finalTarget, Permutation& scratch)
+{
+    const std::size_t k = word.Count();
+    if (k == 0)
+        throw std::invalid_argument("Trying to compose permuations, but none were provided.");
+
+    const std::size_t n = word.Degree(0);
+    for (std::size_t j = 1; j < k; j++)
+    {
+        if (word.Degree(j) != n)
+            throw std::invalid_argument("Cannot compose permutations of different sizes.");
+    }
+
+    if (k == 1)
+    {
+        finalTarget.assign(word.Factor(0), word.Factor(0) + n);
+        return;
+    }
+
+    // The first gather consumes two factors and every later factor costs one more gather. Choose where the first
+    // one writes so that, after alternating between the two buffers, the last one lands in finalTarget.
+    const std::size_t gathers = k - 1;
+    Permutation* target = (gathers % 2 == 1) ? &finalTarget : &scratch;
+    Permutation* previous = (target == &finalTarget) ? &scratch : &finalTarget;
+    target->resize(n);
+    previous->resize(n);
+
+    const std::uint32_t* first = word.Factor(0);
+    const std::uint32_t* second = word.Factor(1);
+    std::uint32_t* destination = target->data();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        destination[i] = first[second[i] - 1];
+    }
+
+    for (std::size_t j = 2; j < k; j++)
+    {
+        std::swap(target, previous);
+
+        const std::uint32_t* source = previous->data();
+        const std::uint32_t* factor = word.Factor(j);
+        destination = target->data();
+        for (std::size_t i = 0; i < n; i++)
+        {
+            destination[i] = source[factor[i] - 1];
+        }
+    }
+}
@@ -0,0 +1,47 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for an engine which composes long products of permutations without allocating
+ */
+
+#pragma once
+
+#include "Sym_data_types.hpp"
+#include "Sym_permutation_batch.hpp"
+
+namespace Sym
+{
+    // Composes words (products) of permutations, following the same convention as ComposePermutations:
+    // the word p1 p2 ... pk is the function x -> p1(p2(...pk(x))).
+    //
+    // Each factor costs a single gather pass. Intermediate results are folded between two buffers owned by the
+    // engine (or between one engine buffer and the caller's output), so once the buffers have grown to the largest
+    // degree seen, composing does not allocate at all. Keep one engine around and reuse it for best results.
+    //
+    // An engine is not safe to share between threads; give each thread its own.
+    class CompositionEngine
+    {
+    public:
+        // Returns a reference to an internal buffer holding the product. It stays valid until the next call on this engine.
+        const Permutation& Compose(const PermutationVector& word);
+
+        // Writes the product to output. The output may be one of the factors in the word.
+        void Compose(const PermutationVector& word, Permutation& output);
+
+        // Same as above for a word stored in a PermutationBatch
+        const Permutation& Compose(const PermutationBatchView& word);
+        void Compose(const PermutationBatchView& word, Permutation& output);
+
+        // Writes permutation1 * permutation2 to output. The output may be one of the two factors.
+        void Compose(const Permutation& permutation1, const Permutation& permutation2, Permutation& output);
+
+    private:
+        // Folds the word so that the final gather lands in finalTarget, using scratch for the intermediate steps.
+        // Word is an adapter over either kind of word, defined in the implementation file.
+        template <typename Word>
+        void Fold(const Word& word, Permutation& finalTarget, Permutation& scratch);
+
+        Permutation m_front;
+        Permutation m_back;
+    };
+}
@@ -0,0 +1,151 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Definitions for a hand-written, single pass parser for cycle notation
+ */
+
+#include "Sym_cycle_notation_fast_parser.hpp"
+#include "Sym_data_types.hpp"
+
+#include <climits>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace Sym;
+
+namespace
+{
+    // Worded exactly like the errors from the flex/bison parser, so callers can't tell which one ran
+    [[noreturn]] void ThrowSyntaxError()
+    {
+        throw std::invalid_argument("Could not parse the cycle notation: syntax error.");
+    }
+
+    [[noreturn]] void ThrowInvalidCharacter(char c)
+    {
+        std::ostringstream oss;
+        oss << "Invalid character: \'" << c << "\'.";
+        throw std::invalid_argument(oss.str());
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+CycleNotationFastParser::CycleNotationFastParser() : m_currentCycleTag(0)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+void CycleNotationFastParser::Parse(std::string_view cycleInput, Permutation& result)
+{
+    // Start from the identity on one symbol, so that no cycles at all (or only empty ones) gives (1)
+    result.resize(1);
+    result[0] = 1;
+
+    bool insideCycle = false;
+    std::uint32_t first = 0;
+    std::uint32_t previous = 0;
+    std::uint32_t firstImage = 0;
+
+    const char* p = cycleInput.data();
+    const char* end = p + cycleInput.size();
+    while (p != end)
+    {
+        const char c = *p;
+
+        if (c == ' ' || c == '\t')
+        {
+            p++;
+        }
+        else if (c == '(')
+        {
+            if (insideCycle)
+                ThrowSyntaxError();
+
+            insideCycle = true;
+            first = 0;
+            m_currentCycleTag++;
+            p++;
+        }
+        else if (c == ')')
+        {
+            if (!insideCycle)
+                ThrowSyntaxError();
+
+            // Last element in the cycle is a special case. It takes the old image of the first element of the cycle.
+            if (first != 0)
+                result[previous - 1] = firstImage;
+
+            insideCycle = false;
+            p++;
+        }
+        else if (c >= '0' && c <= '9')
+        {
+            std::uint64_t value = 0;
+            while (p != end && *p >= '0' && *p <= '9')
+            {
+                // Keep accumulating past the limit only to know where the digits end; the value is rejected below
+                if (value <= INT_MAX)
+                    value = value * 10 + static_cast<std::uint64_t>(*p - '0');
+                p++;
+            }
+
+            if (!insideCycle)
+                ThrowSyntaxError();
+
+            if (value == 0)
+                throw std::invalid_argument("Encountered the nonpositive number \'0\' in a cycle.");
+
+            if (value > INT_MAX)
+                throw std::invalid_argument("Encountered a number too large to be a symbol in a cycle.");
+
+            const std::uint32_t number = static_cast<std::uint32_t>(value);
+            if (number > result.size())
+                ExtendToSymbol(result, number);
+            if (number >= m_lastCycleSeen.size())
+                m_lastCycleSeen.resize(static_cast<std::size_t>(number) + 1, 0);
+
+            if (m_lastCycleSeen[number] == m_currentCycleTag)
+            {
+                std::ostringstream oss;
+                oss << "Encountered the number \'" << number << "\' more than once in the same cycle.";
+                throw std::invalid_argument(oss.str());
+            }
+            m_lastCycleSeen[number] = m_currentCycleTag;
+
+            if (first == 0)
+            {
+                first = number;
+                firstImage = result[number - 1];
+            }
+            else
+            {
+                // If a ---> b in the cycle, then (result * cycle)(a) = result(b). This reads result[b - 1] before the
+                // next number can overwrite it.
+                result[previous - 1] = result[number - 1];
+            }
+
+            previous = number;
+        }
+        else
+        {
+            ThrowInvalidCharacter(c);
+        }
+    }
+
+    if (insideCycle)
+        ThrowSyntaxError();
+}
+
+// -------------------------------------------------------------------------------------------------
+void CycleNotationFastParser::ExtendToSymbol(Permutation& result, std::uint32_t symbol)
+{
+    std::size_t oldSize = result.size();
+    result.resize(symbol);
+    for (std::size_t i = oldSize; i < symbol; i++)
+    {
+        result[i] = static_cast<std::uint32_t>(i + 1);
+    }
+}
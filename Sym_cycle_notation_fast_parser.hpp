@@ -0,0 +1,42 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for a hand-written, single pass parser for cycle notation
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "Sym_data_types.hpp"
+
+namespace Sym
+{
+    // Parses the same cycle notation as CycleNotationParser (see ProcessCycleNotationInput) and reports the same errors,
+    // but in one pass over the characters with no tokens, no intermediate cycles and no I/O.
+    //
+    // Each cycle is folded into the result as soon as its numbers are read: multiplying the result on the right by
+    // (a1 a2 ... am) just moves the images of a2, ..., am, a1 into positions a1, ..., am-1, am, which can be done in
+    // place while streaming through the cycle. So the only storage is the caller's result buffer plus a table used to
+    // spot repeated numbers, and neither allocates once they have grown to the largest symbol seen.
+    //
+    // Like CycleNotationParser, an instance should not be shared between threads.
+    class CycleNotationFastParser
+    {
+    public:
+        CycleNotationFastParser();
+
+        // Throws std::invalid_argument if the input is malformed, in which case result is left unspecified.
+        void Parse(std::string_view cycleInput, Permutation& result);
+
+    private:
+        // Grows result to cover the given symbol, fixing every new symbol
+        static void ExtendToSymbol(Permutation& result, std::uint32_t symbol);
+
+        // Same scheme as CycleNotationParseState: the tag of the last cycle each number appeared in
+        std::vector<std::size_t> m_lastCycleSeen;
+        std::size_t m_currentCycleTag;
+    };
+}
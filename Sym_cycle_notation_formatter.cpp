@@ -0,0 +1,223 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Implementations for the cycle notation formatter
+ */
+
+// Normal includes
+#include "Sym_cycle_notation_formatter.hpp"
+#include "Sym_data_types.hpp"
+#include "Sym_permutation_batch.hpp"
+
+// C++ Standard Library includes
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Sym;
+
+namespace
+{
+    // A symbol has at most 10 digits, and is preceded by at most '(' and followed by ' ' or ')'
+    constexpr std::size_t MAX_ELEMENT_CHARS = 12;
+
+    // Slack on top of LengthBound, which only counts well-formed cycles: the walk that finds an input is not a
+    // bijection may have opened one more bracket before it throws.
+    constexpr std::size_t LENGTH_BOUND_SLACK = 4;
+
+    // Every moved symbol is written exactly once, followed by a space or ')'. Every cycle also adds a '(', and since
+    // a written cycle moves at least two symbols, there are at most half as many of those as moved symbols.
+    // This is one sequential pass, much cheaper than the cycle walk itself.
+    std::size_t LengthBound(PermutationView permutation)
+    {
+        std::size_t length = 0;
+        std::size_t moved = 0;
+        std::size_t digits = 1;
+        std::uint64_t nextPowerOfTen = 10;
+        for (std::size_t i = 0; i < permutation.size(); i++)
+        {
+            const std::uint64_t symbol = i + 1;
+            if (symbol == nextPowerOfTen)
+            {
+                digits++;
+                nextPowerOfTen *= 10;
+            }
+
+            if (permutation[i] != symbol)
+            {
+                length += digits + 1;
+                moved++;
+            }
+        }
+
+        // The identity is written as (1)
+        return moved == 0 ? 3 : length + moved / 2 + LENGTH_BOUND_SLACK;
+    }
+
+    // Writes into memory which is already known to be large enough
+    struct BufferOutput
+    {
+        char* m_cursor;
+
+        void Ensure(std::size_t count) {}
+    };
+
+    // Writes into a fixed chunk, handing it to the sink whenever it might not fit the next element
+    struct SinkOutput
+    {
+        char* m_begin;
+        char* m_end;
+        char* m_cursor;
+        const CycleNotationFormatter::Sink& m_sink;
+
+        void Ensure(std::size_t count)
+        {
+            if (static_cast<std::size_t>(m_end - m_cursor) < count)
+                Flush();
+        }
+
+        void Flush()
+        {
+            if (m_cursor != m_begin)
+                m_sink(std::string_view(m_begin, m_cursor - m_begin));
+            m_cursor = m_begin;
+        }
+    };
+
+    template <typename Output>
+    void FormatCycles(PermutationView permutation, std::uint64_t* visited, Output& output)
+    {
+        const std::size_t n = permutation.size();
+        bool wroteCycle = false;
+
+        for (std::size_t start = 0; start < n; start++)
+        {
+            // Skip symbols already written as part of an earlier cycle, and fixed points, which are left implicit
+            if ((visited[start >> 6] >> (start & 63)) & 1)
+                continue;
+            if (permutation[start] == start + 1)
+                continue;
+
+            output.Ensure(MAX_ELEMENT_CHARS);
+            *output.m_cursor++ = '(';
+
+            std::size_t current = start;
+            while (true)
+            {
+                visited[current >> 6] |= std::uint64_t(1) << (current & 63);
+
+                output.Ensure(MAX_ELEMENT_CHARS);
+                output.m_cursor = std::to_chars(output.m_cursor, output.m_cursor + MAX_ELEMENT_CHARS, static_cast<std::uint32_t>(current + 1)).ptr;
+
+                std::uint32_t image = permutation[current];
+                if (image == 0 || image > n)
+                {
+                    std::ostringstream oss;
+                    oss << "Permutation contains the value \'" << image << "\', which is not between 1 and " << n << ".";
+                    throw std::invalid_argument(oss.str());
+                }
+
+                std::size_t next = image - 1;
+                if (next == start)
+                {
+                    *output.m_cursor++ = ')';
+                    break;
+                }
+
+                // In a bijection, the walk can only ever come back to its start, never to a symbol that has been
+                // written already or to a fixed point. Checking here also guarantees the walk ends within n steps.
+                if (((visited[next >> 6] >> (next & 63)) & 1) || permutation[next] == next + 1)
+                    throw std::invalid_argument("Permutation is not a bijection! The input may be corrupt.");
+
+                *output.m_cursor++ = ' ';
+                current = next;
+            }
+
+            wroteCycle = true;
+        }
+
+        // Rather than write nothing at all for the identity, write (1)
+        if (!wroteCycle)
+        {
+            output.Ensure(3);
+            *output.m_cursor++ = '(';
+            *output.m_cursor++ = '1';
+            *output.m_cursor++ = ')';
+        }
+    }
+}
+
+void CycleNotationFormatter::Append(PermutationView permutation, std::string& output)
+{
+    const std::size_t oldSize = output.size();
+    output.resize(oldSize + LengthBound(permutation));
+    ResetVisited(permutation.size());
+
+    BufferOutput buffer{ output.data() + oldSize };
+    try
+    {
+        FormatCycles(permutation, m_visited.data(), buffer);
+    }
+    catch (...)
+    {
+        output.resize(oldSize);
+        throw;
+    }
+
+    output.resize(buffer.m_cursor - output.data());
+}
+
+void CycleNotationFormatter::Write(PermutationView permutation, const Sink& sink)
+{
+    m_chunk.resize(CHUNK_SIZE);
+    ResetVisited(permutation.size());
+
+    SinkOutput chunk{ m_chunk.data(), m_chunk.data() + m_chunk.size(), m_chunk.data(), sink };
+    FormatCycles(permutation, m_visited.data(), chunk);
+    chunk.Flush();
+}
+
+void CycleNotationFormatter::FormatBatch(const PermutationBatchView& batch, std::string& text, std::vector<std::size_t>& offsets, char separator)
+{
+    // Size the text once for the whole batch
+    std::size_t totalBound = 0;
+    for (std::size_t i = 0; i < batch.Count(); i++)
+    {
+        totalBound += LengthBound(batch[i]) + 1;
+    }
+
+    text.resize(totalBound);
+    offsets.clear();
+    offsets.push_back(0);
+
+    BufferOutput buffer{ text.data() };
+    try
+    {
+        for (std::size_t i = 0; i < batch.Count(); i++)
+        {
+            ResetVisited(batch.Degree());
+            FormatCycles(batch[i], m_visited.data(), buffer);
+            *buffer.m_cursor++ = separator;
+            offsets.push_back(buffer.m_cursor - text.data());
+        }
+    }
+    catch (...)
+    {
+        text.clear();
+        offsets.clear();
+        throw;
+    }
+
+    text.resize(buffer.m_cursor - text.data());
+}
+
+void CycleNotationFormatter::ResetVisited(std::size_t n)
+{
+    // Allocates only when a permutation is larger than any seen before
+    m_visited.assign((n + 63) / 64, 0);
+}
@@ -0,0 +1,59 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for a formatter which writes permutations in cycle notation without per-element allocation
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Sym_data_types.hpp"
+#include "Sym_permutation_batch.hpp"
+
+namespace Sym
+{
+    // Writes permutations as products of disjoint cycles, e.g. "(1 2 3)(4 5)", starting each cycle at its smallest
+    // symbol and leaving out fixed points. The identity is written "(1)". This is the canonical form produced by
+    // GetCycleNotationString.
+    //
+    // Visited symbols are tracked in a bitset and numbers are written with std::to_chars straight into the
+    // destination, which is sized once up front from a bound on the output length. A permutation of 10^7 symbols
+    // formats in a single pass over its cycles. Reusing a formatter keeps the bitset (and the chunk buffer used for
+    // sinks) allocated between calls.
+    //
+    // Input which is not a bijection on 1 to n throws std::invalid_argument rather than looping forever.
+    //
+    // Like CompositionEngine, a formatter should not be shared between threads.
+    class CycleNotationFormatter
+    {
+    public:
+        // Receives the output a chunk at a time. Each chunk is only valid for the duration of the call.
+        using Sink = std::function<void(std::string_view)>;
+
+        // Appends the cycle notation of permutation to output
+        void Append(PermutationView permutation, std::string& output);
+
+        // Streams the cycle notation to sink in chunks of at most CHUNK_SIZE characters, so that the whole string
+        // never has to exist in memory at once
+        void Write(PermutationView permutation, const Sink& sink);
+
+        // Formats every permutation in the batch into one contiguous text buffer, each one followed by separator.
+        // Permutation i occupies text[offsets[i], offsets[i + 1] - 1), and offsets has batch.Count() + 1 entries.
+        void FormatBatch(const PermutationBatchView& batch, std::string& text, std::vector<std::size_t>& offsets, char separator = '\n');
+
+        static constexpr std::size_t CHUNK_SIZE = 1 << 16;
+
+    private:
+        // Clears the bitset for a permutation of n symbols
+        void ResetVisited(std::size_t n);
+
+        std::vector<std::uint64_t> m_visited;
+        std::vector<char> m_chunk;
+    };
+}
@@ -7,129 +7,133 @@
 #include "Sym_cycle_notation_parser.hpp"
 #include "Sym_symmetric_group.hpp"
 
-#include <iostream>
+// Generated by Bison
+#include "cycle_notation_parser.hpp"
+// Generated by Flex
+#include "cycle_notation_scanner.hpp"
+
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
-#include <unordered_set>
 
 using namespace Sym;
 
 // -------------------------------------------------------------------------------------------------
-NumNode* Sym::AddNodeToTail(NumNode* head, int value)
+CycleNotationParser::CycleNotationParser() : m_scanner(nullptr)
 {
-    if (value <= 0)
-    {
-        std::ostringstream oss;
-        oss << "Encountered the nonpositive number \'" << value << "\' in a cycle.";
-        throw std::exception(oss.str().c_str());
-    }
-    
-    NumNode* temp = new NumNode(value, nullptr);
-
-    if (head == nullptr)
-    {
-        head = temp;
-    }
-    else
-    {
-        NumNode* p = head;
-        while (p->m_next != nullptr)
-        {
-            p = p->m_next;
-        }
-        p->m_next = temp;
-    }
+    if (yylex_init(&m_scanner) != 0)
+        throw std::runtime_error("Failed to initialize the cycle notation scanner.");
+}
 
-    return head;
+// -------------------------------------------------------------------------------------------------
+CycleNotationParser::~CycleNotationParser()
+{
+    yylex_destroy(m_scanner);
 }
 
 // -------------------------------------------------------------------------------------------------
-void Sym::PrintNumNodeList(NumNode* head)
+void CycleNotationParser::Parse(const char* cycleInput, Permutation& result)
 {
-    NumNode* p = head;
+    m_state.Reset();
 
-    while (p != nullptr)
+    YY_BUFFER_STATE buf = yy_scan_string(cycleInput, m_scanner);
+
+    // Errors in the input are thrown from inside yyparse, so the scanner buffer has to be freed on the way out either way.
+    // The scanner itself stays usable afterwards.
+    struct BufferGuard
     {
-        std::cout << p->m_number << " --> ";
-        p = p->m_next;
-    }
-    std::cout << "\n";
+        YY_BUFFER_STATE m_buffer;
+        yyscan_t m_scanner;
+        ~BufferGuard() { yy_delete_buffer(m_buffer, m_scanner); }
+    } guard{ buf, m_scanner };
+
+    yyparse(m_scanner, result, m_state);
 }
 
 // -------------------------------------------------------------------------------------------------
-void Sym::FreeNumNodeList(NumNode* head)
+CycleNotationParseState::CycleNotationParseState() : m_largestNumber(1), m_currentCycleTag(1)
 {
-    NumNode* p = head;
+}
 
-    while (p != nullptr)
-    {
-        NumNode* temp = p->m_next;
-        delete p;
-        p = temp;
-    }
+// -------------------------------------------------------------------------------------------------
+void CycleNotationParseState::Reset()
+{
+    // Clearing keeps the capacity of every buffer, so a reused state stops allocating once it has seen its largest input
+    m_numbers.clear();
+    m_cycleEnds.clear();
+    m_largestNumber = 1;
+    m_currentCycleTag++;
 }
 
 // -------------------------------------------------------------------------------------------------
-Permutation* Sym::CreatePermutation(NumNode* head)
+void CycleNotationParseState::AddNumber(int value)
 {
-    // Example: for (2 4 3), we will assume this is a permutation on 4 symbols.
-    NumNode* p = head;
-    int max = 1;
-    while (p != nullptr)
+    if (value <= 0)
     {
-        if (p->m_number > max)
-            max = p->m_number;
-
-        p = p->m_next;
+        std::ostringstream oss;
+        oss << "Encountered the nonpositive number \'" << value << "\' in a cycle.";
+        throw std::invalid_argument(oss.str());
     }
 
-    Permutation* perm = new Permutation(max);
+    std::uint32_t number = static_cast<std::uint32_t>(value);
+    if (number >= m_lastCycleSeen.size())
+        m_lastCycleSeen.resize(static_cast<std::size_t>(number) + 1, 0);
 
-    // Initializing the permutation to identity is useful since it enforces this rule:
-    // In a cycle, any number not explicitly written is mapped to itself.
-    SetToIdentity(*perm);
-    
-    std::unordered_set<int> encounteredNumbers;
-    p = head;
-    while (p != nullptr)
+    // Numbers may appear in several cycles of a product, just not twice in the same cycle
+    if (m_lastCycleSeen[number] == m_currentCycleTag)
     {
-        auto iter = encounteredNumbers.find(p->m_number);
-        if (iter != encounteredNumbers.end())
-        {
-            std::ostringstream oss;
-            oss << "Encountered the number \'" << p->m_number << "\' more than once in the same cycle.";
-            throw std::exception(oss.str().c_str());
-        }
-
-        encounteredNumbers.insert(p->m_number);
-
-        NumNode* next = p->m_next;
-
-        // Last element in the cycle is a special case. It should be mapped to the first element of the cycle.
-        if (next == nullptr)
-        {
-            (*perm)[p->m_number - 1] = head->m_number;
-            break;
-        }
-        
-        // If a ---> b, then b is placed at index a - 1. 
-        (*perm)[p->m_number - 1] = next->m_number;
-
-        p = p->m_next;
+        std::ostringstream oss;
+        oss << "Encountered the number \'" << number << "\' more than once in the same cycle.";
+        throw std::invalid_argument(oss.str());
     }
 
-    return perm;
+    m_lastCycleSeen[number] = m_currentCycleTag;
+    m_numbers.push_back(number);
+    m_largestNumber = std::max(m_largestNumber, number);
+}
+
+// -------------------------------------------------------------------------------------------------
+void CycleNotationParseState::EndCycle()
+{
+    m_cycleEnds.push_back(m_numbers.size());
+    m_currentCycleTag++;
 }
 
 // -------------------------------------------------------------------------------------------------
-PermutationVector* Sym::AddCycleToTail(PermutationVector* vec, Permutation* perm)
+void CycleNotationParseState::Finish(Permutation& result)
 {
-    if (vec == nullptr)
+    // Example: for (2 4 3), we will assume this is a permutation on 4 symbols. With several cycles, every one of them
+    // is treated as a permutation on the largest symbol appearing anywhere, so they can all be stored in one batch.
+    m_cycles.Reset(m_largestNumber);
+    m_cycles.Reserve(m_cycleEnds.size());
+
+    std::size_t cycleStart = 0;
+    for (std::size_t cycleEnd : m_cycleEnds)
     {
-        vec = new PermutationVector();
+        // Initializing the permutation to identity is useful since it enforces this rule:
+        // In a cycle, any number not explicitly written is mapped to itself.
+        WriteCycle(m_numbers.data() + cycleStart, cycleEnd - cycleStart, m_cycles.AppendIdentity());
+        cycleStart = cycleEnd;
     }
 
-    vec->push_back(perm);
+    // No cycles at all is the identity, written (1)
+    if (m_cycles.Empty())
+        m_cycles.AppendIdentity();
+
+    m_engine.Compose(m_cycles.View(), result);
+}
+
+// -------------------------------------------------------------------------------------------------
+void Sym::WriteCycle(const std::uint32_t* cycle, std::size_t length, MutablePermutationView permutation)
+{
+    if (length == 0)
+        return;
+
+    for (std::size_t i = 0; i + 1 < length; i++)
+    {
+        permutation[cycle[i] - 1] = cycle[i + 1];
+    }
 
-    return vec;
-}
\ No newline at end of file
+    // Last element in the cycle is a special case. It should be mapped to the first element of the cycle.
+    permutation[cycle[length - 1] - 1] = cycle[0];
+}
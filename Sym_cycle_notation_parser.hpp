@@ -6,25 +6,73 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Sym_composition_engine.hpp"
 #include "Sym_data_types.hpp"
+#include "Sym_permutation_batch.hpp"
 
 namespace Sym
 {
-    struct NumNode
+    // Holds everything the cycle notation parser builds while it runs. The grammar actions only ever append to buffers
+    // owned by this object (the semantic values carry no heap pointers), so nothing leaks if parsing stops early
+    // because of a syntax error or an exception. Reusing one state across calls also reuses all of its buffers.
+    class CycleNotationParseState
     {
-        NumNode(int number, NumNode* next) : m_number(number), m_next(next) {};
+    public:
+        CycleNotationParseState();
+
+        // Forgets any partially parsed input. Called before each parse.
+        void Reset();
+
+        // Adds a number to the cycle currently being read
+        void AddNumber(int value);
+
+        // Closes the cycle currently being read
+        void EndCycle();
+
+        // Turns every cycle read so far into a permutation on the largest symbol seen, then composes them into result.
+        void Finish(Permutation& result);
 
-        int m_number;
-        NumNode* m_next;
+    private:
+        // The numbers of every cycle, back to back. Cycle j occupies [m_cycleEnds[j - 1], m_cycleEnds[j]).
+        std::vector<std::uint32_t> m_numbers;
+        std::vector<std::size_t> m_cycleEnds;
+        std::uint32_t m_largestNumber;
+
+        // m_lastCycleSeen[x] is the tag of the last cycle containing x, for detecting repeats in O(1). Every cycle ever
+        // read by this state gets a fresh tag, so the table never needs clearing between cycles or between parses.
+        std::vector<std::size_t> m_lastCycleSeen;
+        std::size_t m_currentCycleTag;
+
+        PermutationBatch m_cycles;
+        CompositionEngine m_engine;
     };
 
-    NumNode* AddNodeToTail(NumNode* head, int value);
+    // A reusable cycle notation parser. Each instance owns its own reentrant flex scanner and parse state, so any number
+    // of instances can parse at the same time on different threads. Reusing an instance reuses all of its buffers.
+    class CycleNotationParser
+    {
+    public:
+        CycleNotationParser();
+        ~CycleNotationParser();
 
-    void PrintNumNodeList(NumNode* head);
+        CycleNotationParser(const CycleNotationParser&) = delete;
+        CycleNotationParser& operator=(const CycleNotationParser&) = delete;
 
-    void FreeNumNodeList(NumNode* head);
+        // Parses a product of cycles into result. See ProcessCycleNotationInput for a description of the notation.
+        // Throws std::invalid_argument if the input is malformed.
+        void Parse(const char* cycleInput, Permutation& result);
 
-    PermutationVector* AddCycleToTail(PermutationVector* vec, Permutation* perm);
+    private:
+        // The flex scanner handle (a yyscan_t). Kept opaque so that this header doesn't depend on the generated ones.
+        void* m_scanner;
+        CycleNotationParseState m_state;
+    };
 
-    Permutation* CreatePermutation(NumNode* head);
+    // Writes the cycle (c1 c2 ... ck) into permutation, which should start out as the identity.
+    // If a ---> b, then b is placed at index a - 1.
+    void WriteCycle(const std::uint32_t* cycle, std::size_t length, MutablePermutationView permutation);
 }
@@ -8,9 +8,15 @@
 
 #include <vector>
 #include <cstdint>
+#include <span>
 
 namespace Sym
 {
 	using Permutation = std::vector<std::uint32_t>;
 	using PermutationVector = std::vector<Permutation*>;
+
+	// Non-owning views of the images of a permutation, using the same one-based convention as Permutation.
+	// A Permutation converts to either implicitly, so routines taking a view accept both it and batch entries.
+	using PermutationView = std::span<const std::uint32_t>;
+	using MutablePermutationView = std::span<std::uint32_t>;
 }
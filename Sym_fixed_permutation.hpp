@@ -0,0 +1,234 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declaration and definition of a permutation type whose degree is fixed at compile time
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSSE3__) || defined(__AVX__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "Sym_data_types.hpp"
+
+namespace Sym
+{
+    // A permutation of N symbols stored inline as N bytes. Unlike Permutation, the images are zero-based
+    // (symbol 1 is stored as 0), which is what the byte shuffle instructions expect.
+    //
+    // Everything is constexpr. At run time, composition of 16 symbols compiles down to a single SSSE3 pshufb, and
+    // composition of 32 symbols to a pair of in-lane AVX2 shuffles plus a blend (AVX2 has no cross-lane byte shuffle).
+    // Other degrees, or builds without those instruction sets enabled, fall back to a scalar loop.
+    //
+    // A Permutation with fewer than N symbols can be converted by fixing the extra symbols, which is how the
+    // general routines in Sym_symmetric_group use FixedPermutation<16> and FixedPermutation<32> as fast paths.
+    template <std::size_t N>
+    class FixedPermutation
+    {
+        static_assert(N > 0 && N <= 256, "FixedPermutation stores images in bytes, so it supports at most 256 symbols.");
+
+    public:
+        constexpr FixedPermutation()
+        {
+            for (std::size_t i = 0; i < N; i++)
+            {
+                m_images[i] = static_cast<std::uint8_t>(i);
+            }
+        }
+
+        static constexpr FixedPermutation Identity()
+        {
+            return FixedPermutation();
+        }
+
+        // Accepts any permutation on at most N symbols. Symbols beyond permutation.size() are fixed.
+        static FixedPermutation FromPermutation(PermutationView permutation)
+        {
+            const std::size_t n = permutation.size();
+            if (n > N)
+                throw std::invalid_argument("Permutation has too many symbols to convert to a fixed-size permutation.");
+
+            FixedPermutation result;
+            std::array<bool, N> seen{};
+            for (std::size_t i = 0; i < n; i++)
+            {
+                std::uint32_t value = permutation[i];
+                if (value == 0 || value > n || seen[value - 1])
+                {
+                    std::ostringstream oss;
+                    oss << "Permutation contains the value \'" << value << "\' at position " << i + 1 << ", which makes it not a bijection on 1 to " << n << ".";
+                    throw std::invalid_argument(oss.str());
+                }
+
+                seen[value - 1] = true;
+                result.m_images[i] = static_cast<std::uint8_t>(value - 1);
+            }
+
+            return result;
+        }
+
+        // Skips the validation done by FromPermutation, for callers which already know they hold a bijection.
+        // Values outside 1 to N are stored as 0xFF so that they can never match the image of a valid symbol.
+        static FixedPermutation FromPermutationUnchecked(PermutationView permutation)
+        {
+            FixedPermutation result;
+            for (std::size_t i = 0; i < permutation.size() && i < N; i++)
+            {
+                std::uint32_t value = permutation[i];
+                result.m_images[i] = (value == 0 || value > N) ? 0xFF : static_cast<std::uint8_t>(value - 1);
+            }
+
+            return result;
+        }
+
+        // Writes the images of the first 'degree' symbols to output, using the one-based convention of Permutation.
+        void ToPermutation(Permutation& output, std::size_t degree = N) const
+        {
+            output.resize(degree);
+            for (std::size_t i = 0; i < degree; i++)
+            {
+                output[i] = static_cast<std::uint32_t>(m_images[i]) + 1;
+            }
+        }
+
+        // Zero-based image of the zero-based symbol i
+        constexpr std::uint8_t operator[](std::size_t i) const
+        {
+            return m_images[i];
+        }
+
+        constexpr void Set(std::size_t i, std::uint8_t image)
+        {
+            m_images[i] = image;
+        }
+
+        // Returns permutation1 * permutation2, i.e. x -> permutation1(permutation2(x)), matching ComposePermutations.
+        static constexpr FixedPermutation Compose(const FixedPermutation& permutation1, const FixedPermutation& permutation2)
+        {
+            FixedPermutation result;
+
+            if (!std::is_constant_evaluated())
+            {
+#if defined(__SSSE3__) || defined(__AVX__) || defined(__AVX2__)
+                if constexpr (N == 16)
+                {
+                    __m128i table = _mm_load_si128(reinterpret_cast<const __m128i*>(permutation1.m_images.data()));
+                    __m128i indices = _mm_load_si128(reinterpret_cast<const __m128i*>(permutation2.m_images.data()));
+                    _mm_store_si128(reinterpret_cast<__m128i*>(result.m_images.data()), _mm_shuffle_epi8(table, indices));
+                    return result;
+                }
+#endif
+#if defined(__AVX2__)
+                if constexpr (N == 32)
+                {
+                    __m256i table = _mm256_load_si256(reinterpret_cast<const __m256i*>(permutation1.m_images.data()));
+                    __m256i indices = _mm256_load_si256(reinterpret_cast<const __m256i*>(permutation2.m_images.data()));
+
+                    // vpshufb only looks within each 128-bit lane, so shuffle from both halves of the table and pick
+                    // per byte using bit 4 of the index (shifted up into the sign bit, which is what blendv tests).
+                    __m256i lowHalves = _mm256_permute2x128_si256(table, table, 0x00);
+                    __m256i highHalves = _mm256_permute2x128_si256(table, table, 0x11);
+                    __m256i fromLow = _mm256_shuffle_epi8(lowHalves, indices);
+                    __m256i fromHigh = _mm256_shuffle_epi8(highHalves, indices);
+                    __m256i selectHigh = _mm256_slli_epi16(indices, 3);
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(result.m_images.data()), _mm256_blendv_epi8(fromLow, fromHigh, selectHigh));
+                    return result;
+                }
+#endif
+            }
+
+            for (std::size_t i = 0; i < N; i++)
+            {
+                // Out of range indices can only come from FromPermutationUnchecked; mirror pshufb and keep them harmless
+                std::uint8_t index = permutation2.m_images[i];
+                result.m_images[i] = index < N ? permutation1.m_images[index] : 0xFF;
+            }
+
+            return result;
+        }
+
+        constexpr FixedPermutation Inverse() const
+        {
+            FixedPermutation result;
+            for (std::size_t i = 0; i < N; i++)
+            {
+                result.m_images[m_images[i]] = static_cast<std::uint8_t>(i);
+            }
+
+            return result;
+        }
+
+        constexpr bool IsIdentity() const
+        {
+            if (!std::is_constant_evaluated())
+            {
+#if defined(__SSSE3__) || defined(__AVX__) || defined(__AVX2__)
+                if constexpr (N == 16)
+                {
+                    __m128i images = _mm_load_si128(reinterpret_cast<const __m128i*>(m_images.data()));
+                    __m128i identity = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+                    return _mm_movemask_epi8(_mm_cmpeq_epi8(images, identity)) == 0xFFFF;
+                }
+#endif
+            }
+
+            for (std::size_t i = 0; i < N; i++)
+            {
+                if (m_images[i] != i)
+                    return false;
+            }
+
+            return true;
+        }
+
+        // The least common multiple of the cycle lengths. The largest possible order of a permutation on 256 symbols
+        // (Landau's function) is far below 2^64, so a machine word is always enough here.
+        constexpr std::uint64_t Order() const
+        {
+            std::array<bool, N> visited{};
+            std::uint64_t order = 1;
+            for (std::size_t start = 0; start < N; start++)
+            {
+                if (visited[start])
+                    continue;
+
+                std::uint64_t length = 0;
+                std::size_t current = start;
+                do
+                {
+                    visited[current] = true;
+                    current = m_images[current];
+                    length++;
+                }
+                while (current != start);
+
+                order = std::lcm(order, length);
+            }
+
+            return order;
+        }
+
+        friend constexpr bool operator==(const FixedPermutation& lhs, const FixedPermutation& rhs)
+        {
+            return lhs.m_images == rhs.m_images;
+        }
+
+        friend constexpr FixedPermutation operator*(const FixedPermutation& lhs, const FixedPermutation& rhs)
+        {
+            return Compose(lhs, rhs);
+        }
+
+    private:
+        // Aligned so the 16 and 32 symbol cases can use aligned vector loads and stores
+        alignas(N >= 32 ? 32 : 16) std::array<std::uint8_t, N> m_images{};
+    };
+}
@@ -9,14 +9,11 @@
 #include "Sym_data_types.hpp"
 #include "Sym_input_processing.hpp"
 
-// Generated by Bison
-#include "build/cycle_notation_parser.hpp"
-// Generated by Flex
-#include "build/cycle_notation_scanner.hpp"
-
 // C++ Standard Library includes
 #include <cassert>
+#include <charconv>
 #include <iostream>
+#include <sstream>
 #include <vector>
 #include <stdexcept>
 
@@ -121,15 +118,67 @@ Permutation Sym::InitializePermutation(int size)
 
 Permutation Sym::ProcessCycleNotationInput(const char* cycleInput)
 {
+    // One parser per thread keeps this safe to call concurrently without locking
+    thread_local CycleNotationParser parser;
     Permutation result;
 
-    YY_BUFFER_STATE buf = yy_scan_string(cycleInput);
-    yyparse(result);
-    yy_delete_buffer(buf);
+    parser.Parse(cycleInput, result);
     
     return result;
 }
 
+void Sym::ProcessTableNotationInput(std::string_view tableInput, Permutation& result)
+{
+    result.clear();
+
+    std::size_t pos = 0;
+    while (pos < tableInput.size())
+    {
+        char c = tableInput[pos];
+        if (c == ' ' || c == '\t')
+        {
+            pos++;
+            continue;
+        }
+
+        std::uint32_t value = 0;
+        auto [end, error] = std::from_chars(tableInput.data() + pos, tableInput.data() + tableInput.size(), value);
+        if (error == std::errc::invalid_argument)
+        {
+            std::ostringstream oss;
+            oss << "Invalid character: \'" << c << "\'.";
+            throw std::invalid_argument(oss.str());
+        }
+        if (error != std::errc() || value > 0x7FFFFFFF)
+            throw std::invalid_argument("Encountered a number too large to be a symbol in the table.");
+
+        result.push_back(value);
+        pos = end - tableInput.data();
+    }
+
+    // Check the values form a bijection without any scratch memory, by using the top bit of result[v - 1] to
+    // remember that v has been seen. Values have already been limited to 31 bits above.
+    constexpr std::uint32_t SEEN = 0x80000000;
+    const std::size_t n = result.size();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        std::uint32_t value = result[i] & ~SEEN;
+        if (value == 0 || value > n || (result[value - 1] & SEEN) != 0)
+        {
+            std::ostringstream oss;
+            oss << "The table contains the value \'" << value << "\', but a permutation of " << n << " symbols must use each of 1 to " << n << " exactly once.";
+            throw std::invalid_argument(oss.str());
+        }
+
+        result[value - 1] |= SEEN;
+    }
+
+    for (std::uint32_t& value : result)
+    {
+        value &= ~SEEN;
+    }
+}
+
 void Sym::ResizeAllToMax(PermutationVector& permVector)
 {
     size_t maxSize = 1;
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <string_view>
+
 #include "Sym_data_types.hpp"
 
 namespace Sym
@@ -53,8 +55,19 @@ namespace Sym
     // Also notice that there are multiple different ways to write the same permutation, even just as a single cycle:
     // (143), (431), and (314)
     // all represent the function which maps 1 to 4, 4 to 3, 3 to 1, and 2 to 2.
+    //
+    // This is safe to call from several threads at once. Callers parsing many strings on one thread can avoid
+    // allocating the result each time by keeping their own CycleNotationParser.
     Permutation ProcessCycleNotationInput(const char* cycleInput);
 
+    // Parses a permutation written in one-line table notation, i.e. the bottom row of the table only:
+    //
+    //       [1 2 3]
+    //  f =  [2 3 1]    is written    2 3 1
+    //
+    // Numbers are separated by spaces or tabs. Throws std::invalid_argument unless the numbers are exactly 1 to n in some order.
+    void ProcessTableNotationInput(std::string_view tableInput, Permutation& result);
+
     // Makes all the permutations the same size as the largest one in the list
     void ResizeAllToMax(PermutationVector& permVector);
 }
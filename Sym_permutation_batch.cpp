@@ -0,0 +1,94 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Implementations for contiguous, arena-backed storage of many permutations of the same degree
+ */
+
+#include "Sym_permutation_batch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace Sym;
+
+PermutationBatchView::PermutationBatchView() : m_data(nullptr), m_degree(0), m_count(0), m_stride(0)
+{
+}
+
+PermutationBatchView::PermutationBatchView(const std::uint32_t* data, std::size_t degree, std::size_t count, std::size_t stride)
+    : m_data(data), m_degree(degree), m_count(count), m_stride(stride)
+{
+    if (count > 1 && stride < degree)
+        throw std::invalid_argument("Permutations in a batch view cannot overlap: the stride must be at least the degree.");
+}
+
+PermutationBatchView PermutationBatchView::Slice(std::size_t first, std::size_t count) const
+{
+    if (first > m_count || count > m_count - first)
+        throw std::out_of_range("Slice extends past the end of the permutation batch.");
+
+    return PermutationBatchView(m_data + first * m_stride, m_degree, count, m_stride);
+}
+
+PermutationBatchView PermutationBatchView::EveryNth(std::size_t step) const
+{
+    if (step == 0)
+        throw std::invalid_argument("Step through a permutation batch must be positive.");
+
+    return PermutationBatchView(m_data, m_degree, (m_count + step - 1) / step, m_stride * step);
+}
+
+PermutationBatch::PermutationBatch() : m_degree(0), m_count(0)
+{
+}
+
+PermutationBatch::PermutationBatch(std::size_t degree) : m_degree(degree), m_count(0)
+{
+}
+
+void PermutationBatch::Reset(std::size_t degree)
+{
+    m_degree = degree;
+    Clear();
+}
+
+void PermutationBatch::Clear()
+{
+    m_count = 0;
+    m_arena.clear();
+}
+
+void PermutationBatch::Reserve(std::size_t count)
+{
+    m_arena.reserve(count * m_degree);
+}
+
+MutablePermutationView PermutationBatch::AppendIdentity()
+{
+    std::size_t offset = m_arena.size();
+    m_arena.resize(offset + m_degree);
+
+    std::uint32_t* slot = m_arena.data() + offset;
+    for (std::size_t i = 0; i < m_degree; i++)
+    {
+        slot[i] = static_cast<std::uint32_t>(i + 1);
+    }
+
+    m_count++;
+    return MutablePermutationView(slot, m_degree);
+}
+
+void PermutationBatch::Append(PermutationView permutation)
+{
+    if (permutation.size() != m_degree)
+        throw std::invalid_argument("Cannot add a permutation to a batch of a different degree.");
+
+    m_arena.insert(m_arena.end(), permutation.begin(), permutation.end());
+    m_count++;
+}
+
+PermutationBatchView PermutationBatch::View() const
+{
+    return PermutationBatchView(m_arena.data(), m_degree, m_count, m_degree);
+}
@@ -0,0 +1,84 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for contiguous, arena-backed storage of many permutations of the same degree
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Sym_data_types.hpp"
+
+namespace Sym
+{
+    // Read-only view of permutations of one degree laid out in memory at a fixed stride (in entries) from each other.
+    // Views are cheap to copy and do not own anything; they are invalidated when the underlying batch reallocates.
+    class PermutationBatchView
+    {
+    public:
+        PermutationBatchView();
+        PermutationBatchView(const std::uint32_t* data, std::size_t degree, std::size_t count, std::size_t stride);
+
+        std::size_t Degree() const { return m_degree; }
+        std::size_t Count() const { return m_count; }
+        std::size_t Stride() const { return m_stride; }
+        bool Empty() const { return m_count == 0; }
+        const std::uint32_t* Data() const { return m_data; }
+
+        PermutationView operator[](std::size_t i) const { return PermutationView(m_data + i * m_stride, m_degree); }
+
+        // The permutations first, first + 1, ..., first + count - 1
+        PermutationBatchView Slice(std::size_t first, std::size_t count) const;
+
+        // Every step-th permutation, starting from the first one
+        PermutationBatchView EveryNth(std::size_t step) const;
+
+    private:
+        const std::uint32_t* m_data;
+        std::size_t m_degree;
+        std::size_t m_count;
+        std::size_t m_stride;
+    };
+
+    // Owns many permutations of the same degree, stored back to back in a single arena, so that iterating over
+    // the batch is a linear scan of memory. Permutations are never freed individually: Clear or Reset drop all of
+    // them at once while keeping the arena's capacity for reuse, and the destructor frees the arena in one go.
+    class PermutationBatch
+    {
+    public:
+        PermutationBatch();
+        explicit PermutationBatch(std::size_t degree);
+
+        // Drops every permutation and changes the degree of future ones. The arena's capacity is kept.
+        void Reset(std::size_t degree);
+
+        // Drops every permutation, keeping the degree and the arena's capacity.
+        void Clear();
+
+        void Reserve(std::size_t count);
+
+        // Appends the identity permutation and returns a view of it for the caller to fill in.
+        // The returned view is invalidated by the next append.
+        MutablePermutationView AppendIdentity();
+
+        // Appends a copy of the given permutation, which must have the batch's degree.
+        void Append(PermutationView permutation);
+
+        std::size_t Degree() const { return m_degree; }
+        std::size_t Count() const { return m_count; }
+        bool Empty() const { return m_count == 0; }
+
+        MutablePermutationView operator[](std::size_t i) { return MutablePermutationView(m_arena.data() + i * m_degree, m_degree); }
+        PermutationView operator[](std::size_t i) const { return PermutationView(m_arena.data() + i * m_degree, m_degree); }
+
+        PermutationBatchView View() const;
+
+    private:
+        std::size_t m_degree;
+        std::size_t m_count;
+        std::vector<std::uint32_t> m_arena;
+    };
+}
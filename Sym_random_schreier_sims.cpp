@@ -0,0 +1,147 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Implementations for product replacement and the randomized Schreier-Sims algorithm
+ */
+
+// Normal includes
+#include "Sym_data_types.hpp"
+#include "Sym_random_schreier_sims.hpp"
+#include "Sym_schreier_sims.hpp"
+#include "Sym_symmetric_group.hpp"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace Sym;
+
+namespace
+{
+    // The usual choices: at least ten slots, and enough to hold every generator twice
+    constexpr std::size_t MIN_STATE_SIZE = 10;
+
+    // Steps taken before the first element is returned, to mix the state away from the bare generators
+    constexpr int WARM_UP_STEPS = 50;
+}
+
+ProductReplacement::ProductReplacement(const PermutationVector& generators, std::uint64_t seed) : m_random(seed)
+{
+    if (generators.empty())
+        throw std::invalid_argument("Product replacement needs at least one generator.");
+
+    const std::size_t degree = generators[0]->size();
+    for (const Permutation* generator : generators)
+    {
+        if (generator->size() != degree)
+            throw std::invalid_argument("Permutations provided should not have different sizes.");
+    }
+
+    const std::size_t stateSize = std::max(MIN_STATE_SIZE, 2 * generators.size());
+    for (std::size_t i = 0; i < stateSize; i++)
+    {
+        m_state.push_back(*generators[i % generators.size()]);
+    }
+
+    m_accumulator.resize(degree);
+    SetToIdentity(m_accumulator);
+
+    for (int i = 0; i < WARM_UP_STEPS; i++)
+    {
+        Step();
+    }
+}
+
+const Permutation& ProductReplacement::Next()
+{
+    Step();
+    return m_accumulator;
+}
+
+void ProductReplacement::Step()
+{
+    // Replace a random slot s_i by s_i s_j^(+-1) or s_j^(+-1) s_i for another random slot j, then fold it into the accumulator
+    std::uniform_int_distribution<std::size_t> pickSlot(0, m_state.size() - 1);
+    std::size_t i = pickSlot(m_random);
+    std::size_t j = pickSlot(m_random);
+    while (j == i)
+    {
+        j = pickSlot(m_random);
+    }
+
+    const std::uint64_t coins = m_random();
+    const Permutation* other = &m_state[j];
+    if (coins & 1)
+    {
+        InvertPermutation(m_state[j], m_inverse);
+        other = &m_inverse;
+    }
+
+    if (coins & 2)
+        m_engine.Compose(m_state[i], *other, m_scratch);
+    else
+        m_engine.Compose(*other, m_state[i], m_scratch);
+    std::swap(m_state[i], m_scratch);
+
+    m_engine.Compose(m_accumulator, m_state[i], m_scratch);
+    std::swap(m_accumulator, m_scratch);
+}
+
+StabilizerChain Sym::RandomizedSchreierSims(const PermutationVector& generators, const RandomizedSchreierSimsOptions& options)
+{
+    if (!(options.m_errorProbability > 0 && options.m_errorProbability < 1))
+        throw std::invalid_argument("The error probability must be strictly between 0 and 1.");
+
+    StabilizerChain chain = StabilizerChain::FromGeneratorsIncomplete(generators);
+
+    // The trivial group is complete straight away
+    if (chain.BaseLength() > 0)
+    {
+        // Product replacement wants generators of one degree, and the chain has already checked they are permutations
+        std::vector<Permutation> widened;
+        PermutationVector widenedPointers;
+        for (const Permutation* generator : generators)
+        {
+            widened.push_back(*generator);
+            for (std::size_t i = widened.back().size(); i < chain.Degree(); i++)
+            {
+                widened.back().push_back(static_cast<std::uint32_t>(i + 1));
+            }
+        }
+        for (Permutation& generator : widened)
+        {
+            widenedPointers.push_back(&generator);
+        }
+
+        ProductReplacement random(widenedPointers, options.m_seed);
+        const std::size_t requiredSuccesses = static_cast<std::size_t>(std::ceil(-std::log2(options.m_errorProbability)));
+
+        Permutation residue;
+        std::size_t successes = 0;
+        while (successes < requiredSuccesses)
+        {
+            std::size_t dropped = chain.Sift(random.Next(), residue);
+            if (dropped == chain.BaseLength() && EqualsIdentity(residue))
+            {
+                successes++;
+                continue;
+            }
+
+            // The residue fixes the base points before the level it dropped out at, so it belongs to each of those
+            // stabilizers. The whole group already has the first level's orbit, so that level gains nothing from it.
+            chain.AddStrongGenerator(residue, dropped == 0 ? 0 : 1);
+            successes = 0;
+        }
+    }
+
+    if (options.m_verify)
+        chain.Complete();
+
+    return chain;
+}
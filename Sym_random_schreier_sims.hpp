@@ -0,0 +1,66 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for random group elements by product replacement and the randomized Schreier-Sims algorithm
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Sym_composition_engine.hpp"
+#include "Sym_data_types.hpp"
+#include "Sym_schreier_sims.hpp"
+
+namespace Sym
+{
+    // Produces random elements of the group spanned by some generators with the product replacement algorithm
+    // (Celler, Leedham-Green, Murray, Niemeyer and O'Brien), in its "rattle" form with an accumulator. Each element
+    // costs two compositions. The elements are close to uniformly distributed in practice, though not provably so.
+    //
+    // The generators must be permutations of the same degree. Like CompositionEngine, an instance should not be
+    // shared between threads.
+    class ProductReplacement
+    {
+    public:
+        ProductReplacement(const PermutationVector& generators, std::uint64_t seed);
+
+        // The returned element stays valid until the next call
+        const Permutation& Next();
+
+    private:
+        void Step();
+
+        std::vector<Permutation> m_state;
+        Permutation m_accumulator;
+        Permutation m_inverse;
+        Permutation m_scratch;
+        CompositionEngine m_engine;
+        std::mt19937_64 m_random;
+    };
+
+    struct RandomizedSchreierSimsOptions
+    {
+        // The chance that the chain is incomplete (its order too small, Contains wrongly saying no) when the
+        // algorithm stops. It stops once enough random elements in a row have sifted to the identity.
+        double m_errorProbability = 1e-6;
+
+        // Random elements are drawn from a generator seeded with this, so results are reproducible
+        std::uint64_t m_seed = 0;
+
+        // Completes the chain with the deterministic algorithm afterwards, which makes the result certain. This is
+        // much cheaper than running the deterministic algorithm from scratch, as the chain is usually complete already.
+        bool m_verify = false;
+    };
+
+    // Builds a stabilizer chain by sifting random elements of the group, adding whatever fails to sift as a strong
+    // generator. If the chain is still incomplete, a uniformly random element fails to sift with probability at
+    // least 1/2, so after k consecutive successes the chance of error is at most 2^-k. This avoids checking every
+    // Schreier generator, which is what makes the deterministic algorithm slow at degrees in the tens of thousands.
+    //
+    // The order of the returned chain is never larger than the true order, and Contains never wrongly says yes.
+    StabilizerChain RandomizedSchreierSims(const PermutationVector& generators, const RandomizedSchreierSimsOptions& options);
+}
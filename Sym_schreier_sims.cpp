@@ -0,0 +1,389 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Implementations for stabilizer chains and the deterministic Schreier-Sims algorithm
+ */
+
+// Normal includes
+#include "Sym_big_integer.hpp"
+#include "Sym_composition_engine.hpp"
+#include "Sym_data_types.hpp"
+#include "Sym_schreier_sims.hpp"
+#include "Sym_symmetric_group.hpp"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace Sym;
+
+namespace
+{
+    // Copies permutation into output, fixing every point past its end up to degree
+    void Widen(PermutationView permutation, std::size_t degree, Permutation& output)
+    {
+        output.assign(permutation.begin(), permutation.end());
+        for (std::size_t i = permutation.size(); i < degree; i++)
+        {
+            output.push_back(static_cast<std::uint32_t>(i + 1));
+        }
+    }
+
+    void ValidateGenerator(PermutationView permutation, std::size_t index)
+    {
+        const std::size_t n = permutation.size();
+        std::vector<bool> seen(n, false);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            std::uint32_t value = permutation[i];
+            if (value == 0 || value > n || seen[value - 1])
+            {
+                std::ostringstream oss;
+                oss << "Generator " << index + 1 << " contains the value \'" << value << "\' at position " << i + 1 << ", which makes it not a bijection on 1 to " << n << ".";
+                throw std::invalid_argument(oss.str());
+            }
+
+            seen[value - 1] = true;
+        }
+    }
+}
+
+StabilizerChain::StabilizerChain(std::size_t degree) : m_degree(degree)
+{
+    if (degree > UINT32_MAX - 2)
+        throw std::invalid_argument("The degree of the group is too large.");
+}
+
+StabilizerChain StabilizerChain::FromGenerators(const PermutationVector& generators)
+{
+    StabilizerChain chain = FromGeneratorsIncomplete(generators);
+    chain.Complete();
+    return chain;
+}
+
+StabilizerChain StabilizerChain::FromGeneratorsIncomplete(const PermutationVector& generators)
+{
+    std::size_t degree = 1;
+    for (std::size_t i = 0; i < generators.size(); i++)
+    {
+        ValidateGenerator(*generators[i], i);
+        if (generators[i]->size() > degree)
+            degree = generators[i]->size();
+    }
+
+    StabilizerChain chain(degree);
+
+    // Every generator becomes a strong generator of the first level, and of deeper levels while it fixes their base points
+    Permutation widened;
+    for (const Permutation* generator : generators)
+    {
+        Widen(*generator, degree, widened);
+        if (!EqualsIdentity(widened))
+            chain.AddStrongGenerator(widened, 0);
+    }
+
+    return chain;
+}
+
+std::size_t StabilizerChain::Degree() const
+{
+    return m_degree;
+}
+
+std::size_t StabilizerChain::BaseLength() const
+{
+    return m_levels.size();
+}
+
+std::vector<std::uint32_t> StabilizerChain::Base() const
+{
+    std::vector<std::uint32_t> base;
+    for (const Level& level : m_levels)
+    {
+        base.push_back(level.m_basePoint);
+    }
+
+    return base;
+}
+
+const std::vector<std::uint32_t>& StabilizerChain::Orbit(std::size_t level) const
+{
+    return m_levels.at(level).m_orbit;
+}
+
+const std::vector<Permutation>& StabilizerChain::StrongGenerators() const
+{
+    return m_generators;
+}
+
+BigInteger StabilizerChain::Order() const
+{
+    BigInteger order(1);
+    for (const Level& level : m_levels)
+    {
+        order.MultiplyBy(static_cast<std::uint32_t>(level.m_orbit.size()));
+    }
+
+    return order;
+}
+
+std::size_t StabilizerChain::Sift(PermutationView permutation, Permutation& residue) const
+{
+    if (permutation.size() > m_degree)
+        throw std::invalid_argument("Cannot sift a permutation with more points than the group acts on.");
+
+    Widen(permutation, m_degree, residue);
+    Permutation scratch;
+    return SiftFrom(residue, 0, scratch);
+}
+
+bool StabilizerChain::Contains(PermutationView permutation) const
+{
+    // Points beyond the degree of the group are fixed by every element of it
+    for (std::size_t i = m_degree; i < permutation.size(); i++)
+    {
+        if (permutation[i] != i + 1)
+            return false;
+    }
+
+    Permutation residue;
+    if (Sift(permutation.first(permutation.size() < m_degree ? permutation.size() : m_degree), residue) != BaseLength())
+        return false;
+
+    return EqualsIdentity(residue);
+}
+
+std::size_t StabilizerChain::AddStrongGenerator(const Permutation& generator, std::size_t fromLevel)
+{
+    std::size_t deepest = fromLevel;
+    while (deepest < m_levels.size() && generator[m_levels[deepest].m_basePoint - 1] == m_levels[deepest].m_basePoint)
+    {
+        deepest++;
+    }
+
+    if (deepest == m_levels.size())
+    {
+        // It fixes every base point, so it needs a new one. The first point it moves will do.
+        std::uint32_t point = 1;
+        while (point <= m_degree && generator[point - 1] == point)
+        {
+            point++;
+        }
+
+        if (point > m_degree)
+            throw std::invalid_argument("The identity cannot be added as a strong generator.");
+
+        AppendLevel(point);
+    }
+
+    const std::uint32_t index = static_cast<std::uint32_t>(m_generators.size());
+    m_generators.push_back(generator);
+    m_inverses.emplace_back();
+    InvertPermutation(generator, m_inverses.back());
+
+    for (std::size_t level = fromLevel; level <= deepest; level++)
+    {
+        AddGeneratorToLevel(level, index);
+    }
+
+    for (std::size_t level = fromLevel; level <= deepest; level++)
+    {
+        ShortenSchreierTree(level);
+    }
+
+    return deepest;
+}
+
+void StabilizerChain::Complete()
+{
+    // Work up from the bottom of the chain. While checking level i, levels i+1 onwards are already complete, so
+    // sifting through them is an exact membership test. When a level gains a strong generator, the levels below
+    // it have to be rechecked first.
+    std::size_t remaining = m_levels.size();
+    while (remaining > 0)
+    {
+        std::size_t level = remaining - 1;
+        std::size_t changed = CheckLevel(level);
+        remaining = (changed < m_levels.size()) ? changed + 1 : level;
+    }
+}
+
+void StabilizerChain::AppendLevel(std::uint32_t basePoint)
+{
+    Level level;
+    level.m_basePoint = basePoint;
+    level.m_schreierVector.assign(m_degree, NOT_IN_ORBIT);
+    level.m_schreierVector[basePoint - 1] = ROOT;
+    level.m_orbit.push_back(basePoint);
+    level.m_checkedGenerators.push_back(0);
+    m_levels.push_back(std::move(level));
+}
+
+void StabilizerChain::AddGeneratorToLevel(std::size_t levelIndex, std::uint32_t generatorIndex)
+{
+    Level& level = m_levels[levelIndex];
+    level.m_generators.push_back(generatorIndex);
+
+    // If the orbit is already closed under the new generator, the tree stays as it is. Checks already made by
+    // Complete stay valid too, and the new generator simply counts as unchecked against every point.
+    const Permutation& generator = m_generators[generatorIndex];
+    bool orbitGrows = false;
+    for (std::uint32_t point : level.m_orbit)
+    {
+        if (level.m_schreierVector[generator[point - 1] - 1] == NOT_IN_ORBIT)
+        {
+            orbitGrows = true;
+            break;
+        }
+    }
+
+    if (!orbitGrows)
+        return;
+
+    // Otherwise rebuild the whole Schreier tree breadth first rather than hanging new points off the old tree.
+    // Generators arrive one at a time, and a tree grown from, say, a single long cycle first would be as deep as
+    // the orbit is long, which every coset representative and every sift would then pay for.
+    for (std::uint32_t point : level.m_orbit)
+    {
+        level.m_schreierVector[point - 1] = NOT_IN_ORBIT;
+    }
+
+    level.m_orbit.clear();
+    level.m_orbit.push_back(level.m_basePoint);
+    level.m_schreierVector[level.m_basePoint - 1] = ROOT;
+
+    for (std::size_t i = 0; i < level.m_orbit.size(); i++)
+    {
+        std::uint32_t point = level.m_orbit[i];
+        for (std::uint32_t index : level.m_generators)
+        {
+            std::uint32_t image = m_generators[index][point - 1];
+            if (level.m_schreierVector[image - 1] == NOT_IN_ORBIT)
+            {
+                level.m_schreierVector[image - 1] = index;
+                level.m_orbit.push_back(image);
+            }
+        }
+    }
+
+    // The Schreier generators depend on the coset representatives, so a new tree means checking the level afresh
+    level.m_checkedGenerators.assign(level.m_orbit.size(), 0);
+}
+
+void StabilizerChain::ShortenSchreierTree(std::size_t levelIndex)
+{
+    // Breadth first search puts a deepest point last in the orbit
+    const Level& level = m_levels[levelIndex];
+    const std::uint32_t deepestPoint = level.m_orbit.back();
+    std::size_t depth = 0;
+    for (std::uint32_t point = deepestPoint; point != level.m_basePoint; depth++)
+    {
+        point = m_inverses[level.m_schreierVector[point - 1]][point - 1];
+    }
+
+    std::size_t limit = 2;
+    for (std::size_t size = level.m_orbit.size(); size > 1; size /= 2)
+    {
+        limit += 2;
+    }
+
+    if (depth <= limit)
+        return;
+
+    // The representative of the deepest point lies in G_level and moves its base point, so it can join this level's
+    // generators without changing the group. It roughly halves the depth of the tree, and adding it recursively
+    // shortens the tree further until it is within the limit.
+    Permutation representative;
+    Permutation scratch;
+    CosetRepresentative(levelIndex, deepestPoint, representative, scratch);
+    AddStrongGenerator(representative, levelIndex);
+}
+
+void StabilizerChain::CosetRepresentative(std::size_t levelIndex, std::uint32_t point, Permutation& representative, Permutation& scratch) const
+{
+    // If point = s(parent), the representative of point is s composed with the representative of parent. Walking
+    // from point back to the base point therefore multiplies the generators on the right, in walk order.
+    const Level& level = m_levels[levelIndex];
+    CompositionEngine engine;
+
+    representative.resize(m_degree);
+    SetToIdentity(representative);
+    while (point != level.m_basePoint)
+    {
+        std::uint32_t index = level.m_schreierVector[point - 1];
+        engine.Compose(representative, m_generators[index], scratch);
+        std::swap(representative, scratch);
+        point = m_inverses[index][point - 1];
+    }
+}
+
+std::size_t StabilizerChain::SiftFrom(Permutation& permutation, std::size_t levelIndex, Permutation& scratch) const
+{
+    CompositionEngine engine;
+
+    for (; levelIndex < m_levels.size(); levelIndex++)
+    {
+        const Level& level = m_levels[levelIndex];
+        std::uint32_t point = permutation[level.m_basePoint - 1];
+        if (level.m_schreierVector[point - 1] == NOT_IN_ORBIT)
+            return levelIndex;
+
+        // Multiply by the inverse of the coset representative on the left, one Schreier tree edge at a time, until
+        // the base point is fixed
+        while (point != level.m_basePoint)
+        {
+            std::uint32_t index = level.m_schreierVector[point - 1];
+            engine.Compose(m_inverses[index], permutation, scratch);
+            std::swap(permutation, scratch);
+            point = m_inverses[index][point - 1];
+        }
+    }
+
+    return m_levels.size();
+}
+
+std::size_t StabilizerChain::CheckLevel(std::size_t levelIndex)
+{
+    CompositionEngine engine;
+    Permutation representative;
+    Permutation schreierGenerator;
+    Permutation scratch;
+
+    // Adding a strong generator ends the check, so the level can't change underneath this loop
+    Level& level = m_levels[levelIndex];
+    for (std::size_t i = 0; i < level.m_orbit.size(); i++)
+    {
+        const std::uint32_t point = level.m_orbit[i];
+        bool haveRepresentative = false;
+
+        for (; level.m_checkedGenerators[i] < level.m_generators.size(); level.m_checkedGenerators[i]++)
+        {
+            const std::uint32_t generatorIndex = level.m_generators[level.m_checkedGenerators[i]];
+            const Permutation& generator = m_generators[generatorIndex];
+
+            // If s is the tree edge from p to s(p), then u_s(p) = s u_p and the Schreier generator is the identity
+            if (level.m_schreierVector[generator[point - 1] - 1] == generatorIndex)
+                continue;
+
+            if (!haveRepresentative)
+            {
+                CosetRepresentative(levelIndex, point, representative, scratch);
+                haveRepresentative = true;
+            }
+
+            // Sifting s u_p from this level first strips the representative of s(p), which leaves the Schreier
+            // generator u_s(p)^-1 s u_p. That then has to sift through the (complete) levels below.
+            engine.Compose(generator, representative, schreierGenerator);
+
+            std::size_t dropped = SiftFrom(schreierGenerator, levelIndex, scratch);
+            if (dropped < m_levels.size() || !EqualsIdentity(schreierGenerator))
+                return AddStrongGenerator(schreierGenerator, levelIndex + 1);
+        }
+    }
+
+    return m_levels.size();
+}
@@ -0,0 +1,124 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for stabilizer chains of permutation groups and the Schreier-Sims algorithm which builds them
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Sym_big_integer.hpp"
+#include "Sym_data_types.hpp"
+
+namespace Sym
+{
+    // A base and strong generating set for the group spanned by some permutations, i.e. a chain of subgroups
+    //
+    //   G = G_0 >= G_1 >= ... >= G_k = 1,    where G_(i+1) is the subgroup of G_i fixing the base point b_i.
+    //
+    // Each level stores the orbit of its base point under the strong generators which fix the earlier base points,
+    // as a Schreier vector: for every point in the orbit, the strong generator which first reached it. A coset
+    // representative is rebuilt by walking back along the vector to the base point. This uses one word per point
+    // and level, instead of a whole permutation per point as stored transversals would, which is what makes degrees
+    // in the thousands practical.
+    //
+    // Points, base points and permutations all use the same one-based convention as Permutation. The group has the
+    // degree of the largest generator; smaller generators fix the extra points.
+    class StabilizerChain
+    {
+    public:
+        // The chain of the trivial group on 'degree' points
+        explicit StabilizerChain(std::size_t degree);
+
+        // Runs the deterministic Schreier-Sims algorithm on the generators. Throws std::invalid_argument if any of
+        // them is not a permutation.
+        static StabilizerChain FromGenerators(const PermutationVector& generators);
+
+        // The starting point of FromGenerators: validates the generators and adds each one as a strong generator,
+        // but does not Complete the chain. Its order is then only a lower bound for the order of the group.
+        static StabilizerChain FromGeneratorsIncomplete(const PermutationVector& generators);
+
+        std::size_t Degree() const;
+        std::size_t BaseLength() const;
+
+        // The base points b_0, ..., b_(k-1)
+        std::vector<std::uint32_t> Base() const;
+
+        // The orbit of b_level under G_level, starting with b_level itself
+        const std::vector<std::uint32_t>& Orbit(std::size_t level) const;
+
+        // Every strong generator, each stored once no matter how many levels use it
+        const std::vector<Permutation>& StrongGenerators() const;
+
+        // The product of the orbit lengths
+        BigInteger Order() const;
+
+        // Strips coset representatives off the permutation one level at a time. Returns the level at which this
+        // stopped because the image of the base point was outside the orbit, or BaseLength() if every level was
+        // passed. The permutation belongs to the group exactly when BaseLength() is returned and the residue is
+        // the identity. A permutation of smaller degree is treated as fixing the extra points.
+        std::size_t Sift(PermutationView permutation, Permutation& residue) const;
+
+        // A permutation of larger degree than the group can still belong to it, if it fixes every extra point
+        bool Contains(PermutationView permutation) const;
+
+        // Adds a non-identity permutation which fixes b_0, ..., b_(fromLevel-1) as a strong generator of levels
+        // fromLevel, ..., l, where l is the first level whose base point it moves. A new base point is appended if
+        // it moves none of them. Returns l.
+        std::size_t AddStrongGenerator(const Permutation& generator, std::size_t fromLevel);
+
+        // Makes sure the strong generators really do generate every G_i, by sifting each Schreier generator of each
+        // level and adding whatever fails to sift. This is the deterministic Schreier-Sims algorithm; applied to a
+        // chain made some other way, such as by the randomized algorithm, it finishes or verifies that chain.
+        void Complete();
+
+    private:
+        struct Level
+        {
+            std::uint32_t m_basePoint;
+
+            // Indices into m_generators of the strong generators which fix the earlier base points
+            std::vector<std::uint32_t> m_generators;
+
+            std::vector<std::uint32_t> m_orbit;
+
+            // For each point (zero-based), the index of the generator that maps its parent in the Schreier tree
+            // onto it, or one of the markers below
+            std::vector<std::uint32_t> m_schreierVector;
+
+            // For each orbit point, how many of the level's generators have already had their Schreier generator
+            // with it checked by Complete. Checks done at a level stay valid as the levels below it grow, so they
+            // only need redoing when this level's own tree is rebuilt.
+            std::vector<std::uint32_t> m_checkedGenerators;
+        };
+
+        static constexpr std::uint32_t NOT_IN_ORBIT = UINT32_MAX;
+        static constexpr std::uint32_t ROOT = UINT32_MAX - 1;
+
+        void AppendLevel(std::uint32_t basePoint);
+        void AddGeneratorToLevel(std::size_t level, std::uint32_t generatorIndex);
+
+        // A single generator of large order (a long cycle, say) makes a Schreier tree as deep as the orbit is long.
+        // Following Seress, this adds coset representatives of deep points as extra generators of the level until
+        // the depth is logarithmic in the orbit length.
+        void ShortenSchreierTree(std::size_t level);
+
+        // Builds the coset representative mapping the level's base point to point
+        void CosetRepresentative(std::size_t level, std::uint32_t point, Permutation& representative, Permutation& scratch) const;
+
+        // Sifts permutation in place, starting at the given level
+        std::size_t SiftFrom(Permutation& permutation, std::size_t level, Permutation& scratch) const;
+
+        // Checks the unchecked Schreier generators of a level. Returns BaseLength() if they all sift, or else the
+        // deepest level that gained a strong generator.
+        std::size_t CheckLevel(std::size_t level);
+
+        std::size_t m_degree;
+        std::vector<Level> m_levels;
+        std::vector<Permutation> m_generators;
+        std::vector<Permutation> m_inverses;
+    };
+}
@@ -4,27 +4,36 @@
     Purpose: Implementations of routines for core algorithms dealing with the symmetric group.
  */
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <functional>
+#include <sstream>
 #include <vector>
 #include <stdexcept>
-#include <unordered_set>
 
+#include "Sym_big_integer.hpp"
+#include "Sym_composition_engine.hpp"
+#include "Sym_cycle_notation_formatter.hpp"
 #include "Sym_data_types.hpp"
+#include "Sym_fixed_permutation.hpp"
 #include "Sym_symmetric_group.hpp"
 
 using namespace Sym;
 
 namespace
 {
-    int factorial(const int n)
+    // Small permutations are widened to a FixedPermutation (fixing the extra symbols) so that composition becomes a
+    // byte shuffle in registers instead of a loop over heap memory.
+    template <std::size_t N>
+    Permutation ComposeFixed(const Permutation& permutation1, const Permutation& permutation2)
     {
-        int val = 1;
-        for (int i = 2; i <= n; i++)
-        {
-            val = val * i;
-        }
+        Permutation result;
+        FixedPermutation<N>::Compose(FixedPermutation<N>::FromPermutationUnchecked(permutation1),
+                                     FixedPermutation<N>::FromPermutationUnchecked(permutation2))
+            .ToPermutation(result, permutation1.size());
 
-        return val;
+        return result;
     }
 }
 
@@ -32,6 +41,12 @@ Permutation Sym::ComposePermutations(const Permutation& permutation1, const Perm
 {
     if (permutation1.size() != permutation2.size())
         throw std::invalid_argument("Cannot compose permutations of different sizes.");
+
+    if (permutation1.size() <= 16)
+        return ComposeFixed<16>(permutation1, permutation2);
+
+    if (permutation1.size() <= 32)
+        return ComposeFixed<32>(permutation1, permutation2);
     
     Permutation result(permutation1.size());
 
@@ -45,17 +60,11 @@ Permutation Sym::ComposePermutations(const Permutation& permutation1, const Perm
 
 Permutation Sym::ComposePermutations(const PermutationVector& permutations)
 {
-    if (permutations.empty())
-        throw std::invalid_argument("Trying to compose permuations, but none were provided.");
+    // Reusing one engine per thread means only the returned permutation is allocated
+    thread_local CompositionEngine engine;
 
-    Permutation result(permutations[0]->size());
-    SetToIdentity(result);
-
-    for (const auto perm : permutations)
-    {
-        Permutation temp(result);
-        result = ComposePermutations(temp, *perm);
-    }
+    Permutation result;
+    engine.Compose(permutations, result);
 
     return result;
 }
@@ -73,26 +82,101 @@ void Sym::CommutePermutations(Permutation& permutation1, Permutation& permutatio
     }
 }
 
-int Sym::CalculateOrder(const Permutation& permutation)
+BigInteger Sym::CalculateOrder(PermutationView permutation)
 {
-    Permutation buffer = permutation;
-    int order = 1;
-    const int max_possible = factorial(permutation.size());
-    while (!Sym::EqualsIdentity(buffer))
+    const std::size_t n = permutation.size();
+
+    // The cycle walk for small permutations can run entirely on the stack
+    if (n <= 32)
+        return BigInteger::FromUInt64(FixedPermutation<32>::FromPermutation(permutation).Order());
+
+    // Walk each disjoint cycle exactly once, recording which cycle lengths occur. Only the distinct lengths
+    // matter for the least common multiple, and there are at most O(sqrt(n)) of them.
+    std::vector<bool> visited(n, false);
+    std::vector<bool> lengthOccurs(n + 1, false);
+    for (std::size_t start = 0; start < n; start++)
+    {
+        if (visited[start])
+            continue;
+
+        std::size_t length = 0;
+        std::size_t current = start;
+        do
+        {
+            visited[current] = true;
+            length++;
+
+            std::uint32_t next = permutation[current];
+            if (next == 0 || next > n)
+            {
+                std::ostringstream oss;
+                oss << "Permutation contains the value \'" << next << "\', which is not between 1 and " << n << ".";
+                throw std::invalid_argument(oss.str());
+            }
+
+            current = next - 1;
+
+            // Arriving at an already visited point other than the start of the cycle means two points map to the same place
+            if (visited[current] && current != start)
+                throw std::invalid_argument("Permutation is not a bijection! The input may be corrupt.");
+        }
+        while (current != start);
+
+        lengthOccurs[length] = true;
+    }
+
+    // lcm = product over primes p of the largest power of p dividing any cycle length
+    std::vector<std::uint32_t> largestPrimePower(n + 1, 1);
+    for (std::uint32_t length = 2; length <= n; length++)
+    {
+        if (!lengthOccurs[length])
+            continue;
+
+        std::uint32_t remaining = length;
+        for (std::uint32_t p = 2; p * p <= remaining; p++)
+        {
+            std::uint32_t primePower = 1;
+            while (remaining % p == 0)
+            {
+                remaining /= p;
+                primePower *= p;
+            }
+
+            if (primePower > largestPrimePower[p])
+                largestPrimePower[p] = primePower;
+        }
+
+        if (remaining > 1 && remaining > largestPrimePower[remaining])
+            largestPrimePower[remaining] = remaining;
+    }
+
+    // Batch up factors in a machine word before touching the big integer, to cut down on the number of passes over its limbs
+    BigInteger order(1);
+    std::uint64_t pending = 1;
+    for (std::uint32_t p = 2; p <= n; p++)
     {
-        buffer = Sym::ComposePermutations(buffer, permutation);
+        if (largestPrimePower[p] == 1)
+            continue;
 
-        order++;
+        if (pending * largestPrimePower[p] > UINT32_MAX)
+        {
+            order.MultiplyBy(static_cast<std::uint32_t>(pending));
+            pending = 1;
+        }
 
-        if (order > max_possible)
-            throw std::invalid_argument("Permutation can never have order greater than the order of the entire symmetric group! The input may be corrupt.");
+        pending *= largestPrimePower[p];
     }
 
+    order.MultiplyBy(static_cast<std::uint32_t>(pending));
+
     return order;
 }
 
-bool Sym::EqualsIdentity(const Permutation& permutation)
+bool Sym::EqualsIdentity(PermutationView permutation)
 {
+    if (permutation.size() <= 16)
+        return FixedPermutation<16>::FromPermutationUnchecked(permutation).IsIdentity();
+
     for (int i = 0; i < permutation.size(); i++)
     {
         if (permutation[i] != i + 1)
@@ -102,73 +186,64 @@ bool Sym::EqualsIdentity(const Permutation& permutation)
     return true;
 }
 
-void Sym::SetToIdentity(Permutation& permutation)
+void Sym::InvertPermutation(PermutationView permutation, Permutation& result)
 {
-    for (int i = 0; i < permutation.size(); i++)
+    const std::size_t n = permutation.size();
+    result.resize(n);
+
+    // If i ---> p[i], then the inverse maps p[i] ---> i
+    for (std::size_t i = 0; i < n; i++)
     {
-        permutation[i] = i + 1;
+        result[permutation[i] - 1] = static_cast<std::uint32_t>(i + 1);
     }
 }
 
-std::string Sym::GetCycleNotationString(const Permutation& permutation)
+std::vector<std::uint32_t> Sym::GetCycleType(PermutationView permutation)
 {
-    std::string cycleString = "";
+    const std::size_t n = permutation.size();
+    std::vector<bool> visited(n, false);
+    std::vector<std::uint32_t> cycleType;
 
-    std::unordered_set<int> numsFound;
-    int n = permutation.size();
-
-    for (int currNum = 1; currNum <= permutation.size(); currNum++)
+    for (std::size_t start = 0; start < n; start++)
     {
-        // If this number has already been seen in some cycle, skip. In general, it's completely
-        // possible and fine for a number to appear in multiple cycles. But here we will write the
-        // permutation as a product of disjoint cycles (no common elements)
-        if (numsFound.find(currNum) != numsFound.end())
-        {
-            continue;
-        }
-
-        // If this number is unmoved by the permutation (maps to itself), skip.
-        // In cycle notation, those numbers are not written and are implied by context.
-        if (currNum == permutation[currNum - 1])
-        {
+        if (visited[start])
             continue;
-        }
-
-        // Traverse through the cycle that currNum is a part of
-        int cycleStart = currNum;
-        cycleString += "(";
 
+        std::uint32_t length = 0;
+        std::size_t current = start;
         do
         {
-            int iterations = 0;
+            visited[current] = true;
+            current = permutation[current] - 1;
+            length++;
 
-            // Since this is a set, if this number has already been encountered, inserting again is a no-op
-            numsFound.insert(currNum);
-
-            cycleString += std::to_string(currNum) + " ";
-
-            currNum = permutation[currNum - 1];
-
-            if (iterations > permutation.size())
-            {
-                throw std::exception("Failed to generate cycle notation string for permutation.");
-            }
-
-            iterations++;
+            if (length > n)
+                throw std::invalid_argument("Permutation is not a bijection! The input may be corrupt.");
         }
-        while(currNum != cycleStart);
-
-        // After reaching the end of the cycle, close the parentheses
-        cycleString.back() = ')';
+        while (current != start);
 
+        cycleType.push_back(length);
     }
 
-    // Special case: If provided the identity permutation, then the above loop skips every element.
-    // But rather than return an empty string, we should return (1).
-    if (cycleString == "")
+    std::sort(cycleType.begin(), cycleType.end(), std::greater<std::uint32_t>());
+
+    return cycleType;
+}
+
+void Sym::SetToIdentity(Permutation& permutation)
+{
+    for (int i = 0; i < permutation.size(); i++)
     {
-        cycleString = "(1)";
+        permutation[i] = i + 1;
     }
+}
+
+std::string Sym::GetCycleNotationString(PermutationView permutation)
+{
+    // Each thread keeps its own formatter, so the visited bitset is only allocated when a larger permutation comes along
+    thread_local CycleNotationFormatter formatter;
 
+    std::string cycleString;
+    formatter.Append(permutation, cycleString);
     return cycleString;
 }
@@ -6,23 +6,40 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
+#include "Sym_big_integer.hpp"
 #include "Sym_data_types.hpp"
 
 namespace Sym
 {
     Permutation ComposePermutations(const Permutation& permutation1, const Permutation& permutation2);
 
+    // Composes the whole list left to right. Callers composing many products should hold on to a CompositionEngine
+    // instead, which avoids allocating the result each time.
     Permutation ComposePermutations(const PermutationVector& permutations);
 
     void CommutePermutations(Permutation& permutation1, Permutation& permutation2);
 
-    int CalculateOrder(const Permutation& permutation);
+    // The order is the least common multiple of the lengths of the disjoint cycles of the permutation. This is
+    // found with one pass over the permutation, and the result is exact no matter how large it gets.
+    BigInteger CalculateOrder(PermutationView permutation);
 
-    bool EqualsIdentity(const Permutation& permutation);
+    bool EqualsIdentity(PermutationView permutation);
+
+    // Writes the inverse permutation to result, which must not be the same object as permutation.
+    void InvertPermutation(PermutationView permutation, Permutation& result);
+
+    // The lengths of the disjoint cycles of the permutation, largest first, counting fixed points as cycles of
+    // length 1. This is a partition of the number of symbols.
+    std::vector<std::uint32_t> GetCycleType(PermutationView permutation);
 
     void SetToIdentity(Permutation& permutation);
 
-    std::string GetCycleNotationString(const Permutation& permutation);
+    // Writes the permutation as a product of disjoint cycles, e.g. (1 2 3)(4 5), or (1) for the identity. Callers
+    // formatting many permutations, or very large ones, can use a CycleNotationFormatter to append to their own
+    // buffer or stream to a sink instead.
+    std::string GetCycleNotationString(PermutationView permutation);
 }
\ No newline at end of file
@@ -0,0 +1,144 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Implementations for the fixed-size thread pool
+ */
+
+#include "Sym_thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace Sym;
+
+unsigned Sym::GetDefaultThreadCount()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+ThreadPool::ThreadPool(unsigned threadCount) : m_task(nullptr), m_generation(0), m_workersRemaining(0), m_stopping(false)
+{
+    threadCount = std::max(1u, threadCount);
+
+    // Worker 0 is whichever thread submits the job
+    for (unsigned i = 1; i < threadCount; i++)
+    {
+        m_threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_jobReady.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+unsigned ThreadPool::Size() const
+{
+    return static_cast<unsigned>(m_threads.size()) + 1;
+}
+
+void ThreadPool::RunOnAll(const std::function<void(unsigned)>& task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_workersRemaining = Size();
+        m_firstError = nullptr;
+        m_generation++;
+    }
+    m_jobReady.notify_all();
+
+    RunTask(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_jobDone.wait(lock, [this] { return m_workersRemaining == 0; });
+    m_task = nullptr;
+
+    if (m_firstError)
+        std::rethrow_exception(m_firstError);
+}
+
+void ThreadPool::ParallelFor(std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t, unsigned)>& body)
+{
+    if (count == 0)
+        return;
+
+    grainSize = std::max<std::size_t>(1, grainSize);
+
+    // Don't bother waking the other workers for a single chunk
+    if (count <= grainSize || Size() == 1)
+    {
+        for (std::size_t begin = 0; begin < count; begin += grainSize)
+        {
+            body(begin, std::min(count, begin + grainSize), 0);
+        }
+        return;
+    }
+
+    // Chunks are claimed dynamically so that uneven chunks still balance out across the workers
+    std::atomic<std::size_t> nextBegin(0);
+    RunOnAll([&](unsigned workerIndex)
+    {
+        while (true)
+        {
+            std::size_t begin = nextBegin.fetch_add(grainSize);
+            if (begin >= count)
+                break;
+
+            body(begin, std::min(count, begin + grainSize), workerIndex);
+        }
+    });
+}
+
+void ThreadPool::WorkerLoop(unsigned workerIndex)
+{
+    std::size_t lastGeneration = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobReady.wait(lock, [&] { return m_stopping || m_generation != lastGeneration; });
+
+            if (m_stopping)
+                return;
+
+            lastGeneration = m_generation;
+        }
+
+        RunTask(workerIndex);
+    }
+}
+
+void ThreadPool::RunTask(unsigned workerIndex)
+{
+    std::exception_ptr error;
+    try
+    {
+        (*m_task)(workerIndex);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (error && !m_firstError)
+        m_firstError = error;
+
+    if (--m_workersRemaining == 0)
+        m_jobDone.notify_one();
+}
@@ -0,0 +1,61 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: Declarations for a small fixed-size thread pool used by the parallel algorithms
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sym
+{
+    // The number of hardware threads, or 1 if that can't be determined
+    unsigned GetDefaultThreadCount();
+
+    // A fixed set of worker threads which run one job at a time. The thread that submits a job takes part in it as
+    // worker 0, so a pool of size 1 starts no threads at all and simply runs everything inline.
+    //
+    // Jobs are identified to the callback by a worker index in [0, Size()), which is handy for indexing per-worker
+    // scratch buffers. If any worker throws, the first exception is rethrown to the submitting thread once every
+    // worker has finished. Only one thread at a time may submit jobs to a pool.
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(unsigned threadCount = GetDefaultThreadCount());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        unsigned Size() const;
+
+        // Calls task(workerIndex) once on every worker and waits for all of them.
+        void RunOnAll(const std::function<void(unsigned)>& task);
+
+        // Splits [0, count) into chunks of at most grainSize indices, hands them out to the workers as they become free,
+        // and calls body(begin, end, workerIndex) for each chunk. Waits until every chunk is done.
+        void ParallelFor(std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t, unsigned)>& body);
+
+    private:
+        void WorkerLoop(unsigned workerIndex);
+        void RunTask(unsigned workerIndex);
+
+        std::vector<std::thread> m_threads;
+
+        std::mutex m_mutex;
+        std::condition_variable m_jobReady;
+        std::condition_variable m_jobDone;
+        const std::function<void(unsigned)>* m_task;
+        std::size_t m_generation;
+        unsigned m_workersRemaining;
+        bool m_stopping;
+        std::exception_ptr m_firstError;
+    };
+}
@@ -0,0 +1,194 @@
+/*
+    Author: Ryan Patrick
+    Timestamp: 17-Oct-2026
+    Purpose: SymmetricGroupExplorerCLI_main.cpp : Defines the entry point for the headless command line tool.
+ */
+
+// CppTrace 3rd-party library includes
+#include <cpptrace/from_current.hpp>
+#include <cpptrace/from_current_macros.hpp>
+
+// Normal includes
+#include "SymCLI_batch_processing.hpp"
+#include "Sym_cycle_notation_fast_parser.hpp"
+#include "Sym_errors.hpp"
+#include "Sym_input_processing.hpp"
+#include "Sym_thread_pool.hpp"
+
+// Standard C++ library includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cerr <<
+            "Usage: SymmetricGroupExplorerCLI <operation> [options]\n"
+            "\n"
+            "Reads one permutation per line and writes one result per line.\n"
+            "\n"
+            "Operations:\n"
+            "  canonical           Rewrite each permutation in canonical form (disjoint cycles, or a table)\n"
+            "  compose             Compose each permutation with the element given by --with\n"
+            "  order               The order of each permutation\n"
+            "  inverse             The inverse of each permutation\n"
+            "  cycle-type          The lengths of the disjoint cycles, largest first\n"
+            "  group               Treat every line as a generator and report the order and a base of the group they\n"
+            "                      generate, and whether the element given by --with belongs to it\n"
+            "\n"
+            "Options:\n"
+            "  --input FILE        Read from FILE instead of standard input\n"
+            "  --output FILE       Write to FILE instead of standard output\n"
+            "  --input-notation    cycle (default) or table\n"
+            "  --output-notation   cycle (default) or table\n"
+            "  --with PERM         The fixed element for compose, or the element to test with group, written in the\n"
+            "                      input notation\n"
+            "  --side SIDE         For compose: right (default) computes x PERM, left computes PERM x\n"
+            "  --threads N         Number of worker threads (default: all hardware threads)\n"
+            "  --piece-size BYTES  Amount of input handed to a worker at a time (default: 1048576)\n";
+    }
+
+    SymCLI::Notation ParseNotation(const std::string& text)
+    {
+        if (text == "cycle")
+            return SymCLI::CYCLE;
+        if (text == "table")
+            return SymCLI::TABLE;
+
+        throw std::invalid_argument("Unknown notation \'" + text + "\'. Expected cycle or table.");
+    }
+
+    SymCLI::Operation ParseOperation(const std::string& text)
+    {
+        if (text == "canonical")
+            return SymCLI::CANONICAL;
+        if (text == "compose")
+            return SymCLI::COMPOSE;
+        if (text == "order")
+            return SymCLI::ORDER;
+        if (text == "inverse")
+            return SymCLI::INVERSE;
+        if (text == "cycle-type")
+            return SymCLI::CYCLE_TYPE;
+        if (text == "group")
+            return SymCLI::GROUP;
+
+        throw std::invalid_argument("Unknown operation \'" + text + "\'.");
+    }
+
+    int Run(int argc, char** argv)
+    {
+        if (argc < 2 || std::strcmp(argv[1], "--help") == 0)
+        {
+            PrintUsage();
+            return argc < 2 ? 2 : 0;
+        }
+
+        SymCLI::BatchOptions options;
+        std::string inputPath;
+        std::string outputPath;
+
+        // Mistakes on the command line get a short message and the usage text rather than a stack trace
+        try
+        {
+            options.m_operation = ParseOperation(argv[1]);
+            options.m_threadCount = Sym::GetDefaultThreadCount();
+
+            std::string fixedElement;
+
+            for (int i = 2; i < argc; i++)
+            {
+                std::string option = argv[i];
+                if (i + 1 >= argc)
+                    throw std::invalid_argument("Option \'" + option + "\' is missing its value.");
+
+                std::string value = argv[++i];
+                if (option == "--input")
+                    inputPath = value;
+                else if (option == "--output")
+                    outputPath = value;
+                else if (option == "--input-notation")
+                    options.m_inputNotation = ParseNotation(value);
+                else if (option == "--output-notation")
+                    options.m_outputNotation = ParseNotation(value);
+                else if (option == "--with")
+                {
+                    fixedElement = value;
+                    options.m_haveFixedElement = true;
+                }
+                else if (option == "--side")
+                {
+                    if (value != "left" && value != "right")
+                        throw std::invalid_argument("Unknown side \'" + value + "\'. Expected left or right.");
+                    options.m_composeSide = value == "left" ? SymCLI::LEFT : SymCLI::RIGHT;
+                }
+                else if (option == "--threads")
+                    options.m_threadCount = static_cast<unsigned>(std::stoul(value));
+                else if (option == "--piece-size")
+                    options.m_pieceSize = std::stoull(value);
+                else
+                    throw std::invalid_argument("Unknown option \'" + option + "\'.");
+            }
+
+            if (options.m_operation == SymCLI::COMPOSE && !options.m_haveFixedElement)
+                throw std::invalid_argument("The compose operation needs an element to compose with, given by --with.");
+
+            if (options.m_haveFixedElement)
+            {
+                if (options.m_inputNotation == SymCLI::CYCLE)
+                    Sym::CycleNotationFastParser().Parse(fixedElement, options.m_fixedElement);
+                else
+                    Sym::ProcessTableNotationInput(fixedElement, options.m_fixedElement);
+            }
+        }
+        catch (const std::invalid_argument& e)
+        {
+            std::cerr << e.what() << "\n\n";
+            PrintUsage();
+            return 2;
+        }
+
+        std::FILE* input = inputPath.empty() ? stdin : std::fopen(inputPath.c_str(), "rb");
+        if (input == nullptr)
+            throw std::runtime_error("Could not open \'" + inputPath + "\' for reading.");
+
+        std::FILE* output = outputPath.empty() ? stdout : std::fopen(outputPath.c_str(), "wb");
+        if (output == nullptr)
+            throw std::runtime_error("Could not open \'" + outputPath + "\' for writing.");
+
+        std::size_t errors = SymCLI::ProcessStream(input, output, options);
+
+        if (input != stdin)
+            std::fclose(input);
+        if (output != stdout && std::fclose(output) != 0)
+            throw std::runtime_error("Failed to finish writing \'" + outputPath + "\'.");
+        else if (output == stdout)
+            std::fflush(stdout);
+
+        if (errors > 0)
+        {
+            std::cerr << errors << " line(s) could not be processed.\n";
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    CPPTRACE_TRY
+    {
+        return Run(argc, argv);
+    }
+    CPPTRACE_CATCH(const std::exception& e)
+    {
+        Sym::PrintErrorToStdErrorStream(e, "Error: ");
+        return 2;
+    }
+}
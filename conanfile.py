@@ -7,28 +7,36 @@ class SymmetricGroupExplorerConan(ConanFile):
     version = "1.0"
     settings = "os", "compiler", "build_type", "arch"
 
-    # Specify dependencies here
-    requires = (
-        "imgui/1.91.8",
-        "cpptrace/1.0.4",
-        "winflexbison/2.5.25"
-    )
+    # Specify dependencies here. The GUI (and so ImGui) is Windows-only, while SymCore and the command line tool build anywhere.
+    def requirements(self):
+        self.requires("cpptrace/1.0.4")
+        if self.settings.os == "Windows":
+            self.requires("imgui/1.91.8")
+            self.requires("winflexbison/2.5.25")
+
+    def build_requirements(self):
+        if self.settings.os != "Windows":
+            self.tool_requires("flex/2.6.4")
+            self.tool_requires("bison/3.8.2")
 
     def generate(self):
         deps = CMakeDeps(self)
         deps.generate()
 
         tc = CMakeToolchain(self)
-        winflexbison = self.dependencies["winflexbison"]
-        bin_dir = winflexbison.cpp_info.bindirs[0]
 
-        flexJoinedPath = os.path.join(bin_dir, "win_flex.exe")
-        print("Setting FLEX_EXECUTABLE=" + flexJoinedPath)
-        tc.cache_variables["FLEX_EXECUTABLE"] = flexJoinedPath
+        # On other platforms, flex and bison are found on the PATH set up by the tool requirements
+        if self.settings.os == "Windows":
+            winflexbison = self.dependencies["winflexbison"]
+            bin_dir = winflexbison.cpp_info.bindirs[0]
 
-        bisonJoinedPath = os.path.join(bin_dir, "win_bison.exe")
-        print("Setting BISON_EXECUTABLE=" + bisonJoinedPath)
-        tc.cache_variables["BISON_EXECUTABLE"] = bisonJoinedPath
+            flexJoinedPath = os.path.join(bin_dir, "win_flex.exe")
+            print("Setting FLEX_EXECUTABLE=" + flexJoinedPath)
+            tc.cache_variables["FLEX_EXECUTABLE"] = flexJoinedPath
+
+            bisonJoinedPath = os.path.join(bin_dir, "win_bison.exe")
+            print("Setting BISON_EXECUTABLE=" + bisonJoinedPath)
+            tc.cache_variables["BISON_EXECUTABLE"] = bisonJoinedPath
 
         tc.generate()
 
@@ -4,69 +4,65 @@
     Purpose: Bison reads this file to generate a cycle notation parser
 */
 
-%{
-#include <iostream>
-#include "cycle_notation_scanner.hpp"
-#include "../Sym_cycle_notation_parser.hpp"
-#include "../Sym_data_types.hpp"
-#include "../Sym_input_processing.hpp"
-#include "../Sym_symmetric_group.hpp"
+%define api.pure full
 
-/* Interface to the scanner*/
-void yyerror(Sym::Permutation&, char* s);
+%code requires {
+#include "Sym_cycle_notation_parser.hpp"
+#include "Sym_data_types.hpp"
 
-%}
+/* The scanner's header needs the parser's token types and vice versa, so declare the scanner handle type here */
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+}
 
-%code requires {
-#include "../Sym_cycle_notation_parser.hpp"
-#include "../Sym_data_types.hpp"
+%code {
+#include <stdexcept>
+#include <string>
+#include "cycle_notation_scanner.hpp"
+#include "Sym_data_types.hpp"
+#include "Sym_symmetric_group.hpp"
+
+/* Interface to the scanner*/
+void yyerror(yyscan_t scanner, Sym::Permutation&, Sym::CycleNotationParseState&, const char* s);
 }
 
+/* All state lives in the arguments, so any number of threads can parse at once as long as each has its own scanner */
+%lex-param { yyscan_t scanner }
+%parse-param { yyscan_t scanner }
 %parse-param { Sym::Permutation& result }
+%parse-param { Sym::CycleNotationParseState& state }
 
+/* Cycles and their numbers are accumulated in the parse state, so the only semantic value is the number token itself */
 %union {
-	struct Sym::NumNode* n = nullptr;
 	int i;
-	Sym::Permutation* p;
-	Sym::PermutationVector* pv;
 }
 
 %token <i> NUMBER
 
-%type <n> number_list
-%type <pv> cycle_list
-%type <p> cycle expression
-
 %%
 expression: cycle_list { 
-							Sym::ResizeAllToMax(*$1);
-							result = Sym::ComposePermutations(*$1);
-							delete $1;
-							$1 = nullptr;
+							state.Finish(result);
 					   }
 
 cycle_list:
- | cycle_list cycle { 
-						$$ = Sym::AddCycleToTail($1, $2);
-					}
+ | cycle_list cycle
 ;
 
 cycle: '(' number_list ')'	{ 
-								$$ = Sym::CreatePermutation($2); 
-								Sym::FreeNumNodeList($2); 
-								$2 = nullptr;
+								state.EndCycle();
 							}
 ;
 
 number_list: /* nothing */
  | number_list NUMBER		{ 
-								$$ = Sym::AddNodeToTail($1, $2);
-								Sym::PrintNumNodeList($1); 
+								state.AddNumber($2);
 							}
 ;
 %%
 
-void yyerror(Sym::Permutation& p, char* s)
+void yyerror(yyscan_t scanner, Sym::Permutation& p, Sym::CycleNotationParseState& state, const char* s)
 {
-	std::cout << "Error: " << s << "\n";
+	throw std::invalid_argument(std::string("Could not parse the cycle notation: ") + s + ".");
 }
\ No newline at end of file